@@ -26,7 +26,9 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <string.h>
+#include <stdatomic.h>
 
 #include "par.h"
 #include "par_nvm.h"
@@ -44,6 +46,380 @@
  */
 #define PAR_MAX_STRING_SIZE							( 32 )
 
+/**
+ * 	Full memory barrier
+ *
+ * @note	Compiles to DMB on Cortex-M.
+ */
+#define PAR_MEMORY_BARRIER()						atomic_thread_fence( memory_order_seq_cst )
+
+/**
+ * 	Live values are owned by other core
+ *
+ * @note	Core that is not owner of shared memory only reads parameters.
+ */
+#if ( 1 == PAR_CFG_SHARED_EN ) && ( 0 == PAR_CFG_SHARED_OWNER_EN )
+	#define PAR_SHARED_READER_EN					( 1 )
+#else
+	#define PAR_SHARED_READER_EN					( 0 )
+#endif
+
+/**
+ * 	Parameter settings access
+ *
+ * @note	Hot settings (min, max, type), default value and cold settings
+ * 			(ID, access, persistence) are placed either in single table or
+ * 			in three separate ones, see "PAR_CFG_TABLE_SOA_EN".
+ */
+#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+	#define PAR_CFG_HOT( par_num )					( gp_par_table_hot[ par_num ] )
+	#define PAR_CFG_DEF( par_num )					( gp_par_table_def[ par_num ] )
+	#define PAR_CFG_COLD( par_num )					( gp_par_table_cold[ par_num ] )
+#else
+	#define PAR_CFG_HOT( par_num )					( gp_par_table[ par_num ] )
+	#define PAR_CFG_DEF( par_num )					( gp_par_table[ par_num ].def )
+	#define PAR_CFG_COLD( par_num )					( gp_par_table[ par_num ] )
+#endif
+
+/**
+ * 	Size of live values buffer addressable by "par_addr_offset_t"
+ *
+ * 	Unit: byte
+ */
+#if ( 1 == PAR_CFG_COMPACT_EN )
+	#define PAR_ADDR_OFFSET_RANGE					( 1UL << ( 8U * PAR_CFG_COMPACT_OFFSET_SIZE ))
+#endif
+
+#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+
+	/**
+	 * 	Parameter live value layout members
+	 *
+	 * @note	Members are emitted in four passes over "PAR_CFG_TABLE",
+	 * 			first all 8 bytes, then 4, 2 and last 1 byte data types.
+	 * 			That way values are grouped by size and there is no padding
+	 * 			between them.
+	 *
+	 * 			Each data type is described by its C type and size, member
+	 * 			is emitted only in pass matching its size.
+	 */
+	#define PAR_LAYOUT_TYPE_U8						uint8_t
+	#define PAR_LAYOUT_TYPE_I8						int8_t
+	#define PAR_LAYOUT_TYPE_U16						uint16_t
+	#define PAR_LAYOUT_TYPE_I16						int16_t
+	#define PAR_LAYOUT_TYPE_U32						uint32_t
+	#define PAR_LAYOUT_TYPE_I32						int32_t
+	#define PAR_LAYOUT_TYPE_F32						float32_t
+	#define PAR_LAYOUT_TYPE_Q15						par_q15_t
+	#define PAR_LAYOUT_TYPE_Q31						par_q31_t
+	#define PAR_LAYOUT_TYPE_U64						uint64_t
+	#define PAR_LAYOUT_TYPE_I64						int64_t
+
+	#define PAR_LAYOUT_SIZE_U8						1
+	#define PAR_LAYOUT_SIZE_I8						1
+	#define PAR_LAYOUT_SIZE_U16						2
+	#define PAR_LAYOUT_SIZE_I16						2
+	#define PAR_LAYOUT_SIZE_U32						4
+	#define PAR_LAYOUT_SIZE_I32						4
+	#define PAR_LAYOUT_SIZE_F32						4
+	#define PAR_LAYOUT_SIZE_Q15						2
+	#define PAR_LAYOUT_SIZE_Q31						4
+	#define PAR_LAYOUT_SIZE_U64						8
+	#define PAR_LAYOUT_SIZE_I64						8
+
+	#define PAR_LAYOUT_EMIT_8_8( ctype, num, dim )	ctype	num dim;
+	#define PAR_LAYOUT_EMIT_8_4( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_8_2( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_8_1( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_4_8( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_4_4( ctype, num, dim )	ctype	num dim;
+	#define PAR_LAYOUT_EMIT_4_2( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_4_1( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_2_8( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_2_4( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_2_2( ctype, num, dim )	ctype	num dim;
+	#define PAR_LAYOUT_EMIT_2_1( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_1_8( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_1_4( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_1_2( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT_1_1( ctype, num, dim )	ctype	num dim;
+
+	#define PAR_LAYOUT_EMIT_( pass, size, ctype, num, dim )	PAR_LAYOUT_EMIT_##pass##_##size( ctype, num, dim )
+	#define PAR_LAYOUT_EMIT( pass, size, ctype, num, dim )	PAR_LAYOUT_EMIT_( pass, size, ctype, num, dim )
+
+	/**
+	 * 	Array parameter member dimension and default value
+	 *
+	 * @note	Default image holds default value only in first element
+	 * 			of array parameter, as C has no initializer repeating
+	 * 			value. Rest of elements are set to default from it.
+	 */
+	#if ( 1 == PAR_CFG_ARRAY_EN )
+		#define PAR_LAYOUT_DIM( ... )				[ PAR_CFG_COL_LEN( __VA_ARGS__ ) ]
+		#define PAR_LAYOUT_DEF_VAL( def )			{ ( def ) }
+	#else
+		#define PAR_LAYOUT_DIM( ... )
+		#define PAR_LAYOUT_DEF_VAL( def )			( def )
+	#endif
+
+	#define PAR_LAYOUT_MEMBER_8( num, id, name, min, max, def, unit, type, access, pers, ... )		PAR_LAYOUT_EMIT( 8, PAR_LAYOUT_SIZE_##type, PAR_LAYOUT_TYPE_##type, num, PAR_LAYOUT_DIM( __VA_ARGS__ ))
+	#define PAR_LAYOUT_MEMBER_4( num, id, name, min, max, def, unit, type, access, pers, ... )		PAR_LAYOUT_EMIT( 4, PAR_LAYOUT_SIZE_##type, PAR_LAYOUT_TYPE_##type, num, PAR_LAYOUT_DIM( __VA_ARGS__ ))
+	#define PAR_LAYOUT_MEMBER_2( num, id, name, min, max, def, unit, type, access, pers, ... )		PAR_LAYOUT_EMIT( 2, PAR_LAYOUT_SIZE_##type, PAR_LAYOUT_TYPE_##type, num, PAR_LAYOUT_DIM( __VA_ARGS__ ))
+	#define PAR_LAYOUT_MEMBER_1( num, id, name, min, max, def, unit, type, access, pers, ... )		PAR_LAYOUT_EMIT( 1, PAR_LAYOUT_SIZE_##type, PAR_LAYOUT_TYPE_##type, num, PAR_LAYOUT_DIM( __VA_ARGS__ ))
+
+	/**
+	 * 	Parameter live value address offset and count
+	 */
+	#define PAR_LAYOUT_OFFSET( num, ... )			[num] = offsetof( par_layout_t, num ),
+	#define PAR_LAYOUT_DEF( num, id, name, min, max, def, ... )	.num = PAR_LAYOUT_DEF_VAL( def ),
+	#define PAR_LAYOUT_COUNT( num, ... )			1U +
+
+	/**
+	 * 	Parameter live values layout
+	 */
+	typedef struct
+	{
+		PAR_CFG_TABLE( PAR_LAYOUT_MEMBER_8 )
+		PAR_CFG_TABLE( PAR_LAYOUT_MEMBER_4 )
+		PAR_CFG_TABLE( PAR_LAYOUT_MEMBER_2 )
+		PAR_CFG_TABLE( PAR_LAYOUT_MEMBER_1 )
+	} par_layout_t;
+
+	/**
+	 * 	Each parameter must be listed exactly once in "PAR_CFG_TABLE"
+	 */
+	_Static_assert(( PAR_CFG_TABLE( PAR_LAYOUT_COUNT ) 0U ) == ePAR_NUM_OF, "Parameter settings invalid: PAR_CFG_TABLE does not match par_num_t!" );
+
+	/**
+	 * 	Live values shall be addressable by "par_addr_offset_t"
+	 */
+	#if ( 1 == PAR_CFG_COMPACT_EN )
+		_Static_assert( sizeof( par_layout_t ) <= PAR_ADDR_OFFSET_RANGE, "Parameter settings invalid: Live values do not fit PAR_CFG_COMPACT_OFFSET_SIZE!" );
+	#endif
+
+	/**
+	 * 	Parameter table compile time checks
+	 *
+	 * @note	For each parameter MIN shall be less than MAX and DEF
+	 * 			shall be within [MIN, MAX], compared in parameter data
+	 * 			type. With direct ID look-up table ID shall fit into it.
+	 *
+	 * 			F32 limits are compared as floating constants, which is
+	 * 			folded by GCC and Clang but reported with "-Wpedantic".
+	 */
+	#if ( 1 == PAR_CFG_ID_LUT_DIRECT_EN )
+		#define PAR_CHECK_ID_RANGE( num, id )		_Static_assert(( id ) <= PAR_CFG_ID_LUT_MAX_ID, "Parameter table invalid: " #num " ID out of look-up table range!" );
+	#else
+		#define PAR_CHECK_ID_RANGE( num, id )
+	#endif
+
+	/**
+	 * 	Array parameter value does not fit into NVM data object, therefore
+	 * 	it can not be persistent
+	 */
+	#if ( 1 == PAR_CFG_ARRAY_EN ) && ( 1 == PAR_CFG_NVM_EN )
+		#define PAR_CHECK_LEN( num, pers, ... )		_Static_assert(( PAR_CFG_COL_LEN( __VA_ARGS__ ) <= 1U ) || ( false == ( pers )), "Parameter table invalid: " #num " array parameter can not be persistent!" );
+	#else
+		#define PAR_CHECK_LEN( num, pers, ... )
+	#endif
+
+	#define PAR_CHECK_ROW( num, id, name, min, max, def, unit, type, access, pers, ... ) \
+		_Static_assert(( PAR_LAYOUT_TYPE_##type )( min ) <  ( PAR_LAYOUT_TYPE_##type )( max ), "Parameter table invalid: " #num " MIN is not less than MAX!" ); \
+		_Static_assert(( PAR_LAYOUT_TYPE_##type )( def ) <= ( PAR_LAYOUT_TYPE_##type )( max ), "Parameter table invalid: " #num " DEF is above MAX!" ); \
+		_Static_assert(( PAR_LAYOUT_TYPE_##type )( min ) <= ( PAR_LAYOUT_TYPE_##type )( def ), "Parameter table invalid: " #num " DEF is below MIN!" ); \
+		PAR_CHECK_ID_RANGE( num, id ) \
+		PAR_CHECK_LEN( num, pers, __VA_ARGS__ )
+
+	PAR_CFG_TABLE( PAR_CHECK_ROW )
+
+	/**
+	 * 	Duplicate IDs are reported by compiler as duplicate case value
+	 *
+	 * @note	Function is never called, it only holds the check.
+	 */
+	#define PAR_CHECK_ID_CASE( num, id, ... )		case ( id ):
+
+	static inline void par_check_table_id(void)
+	{
+		switch ( 0 )
+		{
+			PAR_CFG_TABLE( PAR_CHECK_ID_CASE )
+			default:
+				break;
+		}
+	}
+
+#endif
+
+#if ( 1 == PAR_CFG_SNAPSHOT_EN ) || ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+
+	/**
+	 * 	Live values sequence counters
+	 *
+	 * @note	Kept together with live values, as with shared memory they
+	 * 			are shared between cores as well.
+	 */
+	typedef struct
+	{
+		#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+			volatile uint32_t	seq;							/**<Live values write sequence, odd while write is in progress */
+			volatile uint32_t	isr_seq;						/**<Sequence of "par_set_isr()" writes, odd while write is in progress */
+		#endif
+
+		#if ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+			uint32_t			change_seq;						/**<Global change sequence number, protected by mutex */
+			uint32_t			change_seq_par[ ePAR_NUM_OF ];	/**<Sequence number of last change of each parameter */
+		#endif
+	} par_seq_t;
+
+#endif
+
+#if ( 1 == PAR_CFG_SHARED_EN )
+
+	/**
+	 * 	Shared memory ready signature
+	 */
+	#define PAR_SHARED_READY						( 0x50415253UL )
+
+	/**
+	 * 	Parameters shared memory
+	 *
+	 * @note	Placed by linker at the same address for all cores, see
+	 * 			"PAR_CFG_SHARED_SYMBOL".
+	 */
+	typedef struct
+	{
+		volatile uint32_t	ready;		/**<PAR_SHARED_READY when initialized by owner core */
+		uint32_t			size;		/**<Size of live values layout, must match between cores */
+
+		#if ( 1 == PAR_CFG_SNAPSHOT_EN ) || ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+			par_seq_t		seq;		/**<Sequence counters */
+		#endif
+
+		par_layout_t		value;		/**<Live values */
+	} par_shared_t;
+
+#endif
+
+#if ( 1 == PAR_CFG_NVM_EN )
+
+	/**
+	 * 	Number of 32-bit words in parameter dirty bitmap
+	 */
+	#define PAR_DIRTY_WORD_NUM						(( ePAR_NUM_OF + 31U ) / 32U )
+
+#endif
+
+#if ( 1 == PAR_CFG_NOTIFY_EN )
+
+	/**
+	 * 	Number of 32-bit words in pending notifications bitmap
+	 */
+	#define PAR_NOTIFY_WORD_NUM						(( ePAR_NUM_OF + 31U ) / 32U )
+
+	/**
+	 * 	Parameter change subscription
+	 */
+	typedef struct
+	{
+		par_notify_cb_t	cb;			/**<Callback, NULL for free subscription */
+		void *			p_ctx;		/**<Subscriber context */
+		par_num_t		par_num;	/**<Parameter number or ePAR_NUM_OF for all */
+	} par_sub_t;
+
+#endif
+
+#if ( 0 == PAR_CFG_ID_LUT_DIRECT_EN )
+
+	/**
+	 * 	Parameter ID look-up table entry
+	 */
+	typedef struct
+	{
+		uint16_t	id;			/**<Parameter ID */
+		uint16_t	par_num;	/**<Parameter number (enumeration) */
+	} par_id_lut_t;
+
+#endif
+
+/**
+ * 	Three-way compare of two values of same data type
+ *
+ * @return	Negative if first value is smaller, zero if equal and
+ * 			positive if first value is larger
+ */
+typedef int32_t (*par_type_cmp_t)(const par_type_t * const p_a, const par_type_t * const p_b);
+
+#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN ) && ( 1 == PAR_CFG_NVM_POLICY_EN )
+
+	/**
+	 * 	Check if absolute difference of two values of same data type
+	 * 	reaches threshold
+	 *
+	 * @return	True if |a - b| >= threshold
+	 */
+	typedef bool (*par_type_delta_t)(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+
+	/**
+	 * 	Write-back persistence policy decision
+	 */
+	typedef enum
+	{
+		ePAR_WB_STORE = 0,		/**<Store to NVM now */
+		ePAR_WB_RETRY,			/**<Minimum interval not yet elapsed, schedule again */
+		ePAR_WB_HOLD,			/**<Keep pending until next change or "par_flush()" */
+	} par_wb_policy_t;
+
+#endif
+
+/**
+ * 	Data type descriptor
+ *
+ * @note	All data type specific handling is done thru descriptor,
+ * 			therefore adding new type takes only new descriptor entry.
+ */
+typedef struct
+{
+	par_type_cmp_t	pf_cmp;		/**<Compare function, used for range limiting */
+	uint8_t			size;		/**<Size of single value in bytes */
+	uint8_t			align;		/**<Alignment of value inside RAM in bytes */
+
+	#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN ) && ( 1 == PAR_CFG_NVM_POLICY_EN )
+		par_type_delta_t	pf_delta;	/**<Delta function, used for persistence policy */
+	#endif
+} par_type_desc_t;
+
+/**
+ * 	Generator of three-way compare function for "par_type_t" member
+ */
+#define PAR_TYPE_CMP_FUNC( member ) \
+	static int32_t par_type_cmp_##member(const par_type_t * const p_a, const par_type_t * const p_b) \
+	{ \
+		return ((int32_t)( p_a->member > p_b->member ) - (int32_t)( p_a->member < p_b->member )); \
+	}
+
+/**
+ * 	Generator of delta function for "par_type_t" member
+ *
+ * @note	Difference is calculated in unsigned type of same width
+ * 			("utype"), thus signed values can not overflow.
+ */
+#define PAR_TYPE_DELTA_FUNC( member, utype ) \
+	static bool par_type_delta_##member(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th) \
+	{ \
+		const utype diff = ( p_a->member > p_b->member ) ? (utype)((utype) p_a->member - (utype) p_b->member ) : (utype)((utype) p_b->member - (utype) p_a->member ); \
+		return ( diff >= (utype) p_th->member ); \
+	}
+
+/**
+ * 	Delta function entry of data type descriptor
+ */
+#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN ) && ( 1 == PAR_CFG_NVM_POLICY_EN )
+	#define PAR_TYPE_DELTA( member )				, .pf_delta = par_type_delta_##member
+#else
+	#define PAR_TYPE_DELTA( member )
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
@@ -51,7 +427,13 @@
 /**
  * 	Pointer to parameter table
  */
-static const par_cfg_t * gp_par_table = NULL;
+#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+	static const par_cfg_hot_t *	gp_par_table_hot 	= NULL;
+	static const par_type_t *		gp_par_table_def 	= NULL;
+	static const par_cfg_cold_t *	gp_par_table_cold 	= NULL;
+#else
+	static const par_cfg_t * gp_par_table = NULL;
+#endif
 
 /**
  * 	Initialization guard
@@ -61,9 +443,169 @@ static bool gb_is_init = false;
 /**
  * 	Parameter active value that is stored in RAM and its
  * 	address offsets
+ *
+ * @note	Visible outside of module only because of typed getters
+ * 			inlined from par.h!
+ */
+#if ( 1 == PAR_CFG_SHARED_EN )
+
+	/**
+	 * 	Shared memory, defined by linker script
+	 */
+	extern par_shared_t 	PAR_CFG_SHARED_SYMBOL;
+
+	uint8_t * const				gpu8_par_value 					= (uint8_t*) &PAR_CFG_SHARED_SYMBOL.value;
+	const par_addr_offset_t		g_par_addr_offset[ ePAR_NUM_OF ]	= { PAR_CFG_TABLE( PAR_LAYOUT_OFFSET ) };
+#elif ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+	static par_layout_t			g_par_layout 					= { 0 };
+	uint8_t * const				gpu8_par_value 					= (uint8_t*) &g_par_layout;
+	const par_addr_offset_t		g_par_addr_offset[ ePAR_NUM_OF ]	= { PAR_CFG_TABLE( PAR_LAYOUT_OFFSET ) };
+#else
+	uint8_t * 					gpu8_par_value 					= NULL;
+	par_addr_offset_t 			g_par_addr_offset[ ePAR_NUM_OF ]	= { 0 };
+#endif
+
+/**
+ * 	Default values image
+ *
+ * @note	Laid out exactly as live values and placed in flash. Reset
+ * 			to default is copy of it and it is baseline of change check.
+ */
+#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+	static const par_layout_t	g_par_def_image 	= { PAR_CFG_TABLE( PAR_LAYOUT_DEF ) };
+	static const uint8_t * const	gpu8_par_def_image	= (const uint8_t*) &g_par_def_image;
+#endif
+
+/**
+ * 	Size of parameter live values buffer in bytes
+ *
+ * @note	With static layout needed only for snapshot.
+ */
+#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+	#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+		static const uint32_t	gu32_par_value_size = sizeof( par_layout_t );
+	#endif
+#else
+	static uint32_t 		gu32_par_value_size = 0UL;
+#endif
+
+/**
+ * 	Live values sequence counters
+ */
+#if ( 1 == PAR_CFG_SHARED_EN ) && (( 1 == PAR_CFG_SNAPSHOT_EN ) || ( 1 == PAR_CFG_CHANGE_SEQ_EN ))
+	static par_seq_t * const	gp_par_seq 	= &PAR_CFG_SHARED_SYMBOL.seq;
+#elif ( 1 == PAR_CFG_SNAPSHOT_EN ) || ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+	static par_seq_t			g_par_seq 	= { 0 };
+	static par_seq_t * const	gp_par_seq 	= &g_par_seq;
+#endif
+
+/**
+ * 	Parameter ID to parameter number look-up table
  */
-static uint8_t * 	gpu8_par_value 						= NULL;
-static uint32_t 	gu32_par_addr_offset[ ePAR_NUM_OF ] = { 0 };
+#if ( 1 == PAR_CFG_ID_LUT_DIRECT_EN )
+	static uint16_t 	gu16_par_id_lut[ PAR_CFG_ID_LUT_MAX_ID + 1 ] = { 0 };
+#else
+	static par_id_lut_t	g_par_id_lut[ ePAR_NUM_OF ] = { 0 };
+#endif
+
+#if ( 1 == PAR_CFG_NVM_EN )
+
+	/**
+	 * 	Persistent parameters changed since last store to NVM
+	 *
+	 * @note	One bit per parameter number (enumeration). Protected by
+	 * 			the same mutex as live values.
+	 */
+	static uint32_t gu32_par_dirty[ PAR_DIRTY_WORD_NUM ] = { 0 };
+
+	#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+
+		/**
+		 * 	Parameters scheduled for deferred store to NVM
+		 *
+		 * @note	Same layout as dirty bitmap. Repeated requests for the
+		 * 			same parameter are merged into single NVM write.
+		 */
+		static uint32_t gu32_par_wb_pending[ PAR_DIRTY_WORD_NUM ] = { 0 };
+
+		/**
+		 * 	Time of first and last store request since last flush
+		 *
+		 * 	Unit: ms
+		 */
+		static uint32_t gu32_par_wb_first_ms	= 0UL;
+		static uint32_t gu32_par_wb_last_ms		= 0UL;
+		static bool		gb_par_wb_pending		= false;
+
+		#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+
+			/**
+			 * 	Value and time of last write-back store
+			 *
+			 * @note	Reference for persistence policy. Valid only when
+			 * 			bit of parameter is set inside validity bitmap.
+			 */
+			static par_type_t	g_par_wb_stored[ ePAR_NUM_OF ] 					= { 0 };
+			static uint32_t		gu32_par_wb_stored_ms[ ePAR_NUM_OF ] 			= { 0 };
+			static uint32_t		gu32_par_wb_stored_valid[ PAR_DIRTY_WORD_NUM ] 	= { 0 };
+
+		#endif
+
+	#endif
+
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+
+		/**
+		 * 	Parameters with final live value
+		 *
+		 * @note	Set once value is loaded from NVM or written since init,
+		 * 			thus later load from NVM does not override it. Same
+		 * 			layout as dirty bitmap. Protected by the same mutex as
+		 * 			live values.
+		 */
+		static uint32_t gu32_par_loaded[ PAR_DIRTY_WORD_NUM ] = { 0 };
+
+	#endif
+
+#endif
+
+#if ( 1 == PAR_CFG_STATS_EN )
+
+	/**
+	 * 	Runtime statistics
+	 *
+	 * @note	NVM part is kept by NVM module, see "par_nvm_get_stats()".
+	 */
+	static par_stats_t g_par_stats = { 0 };
+
+#endif
+
+#if ( 1 == PAR_CFG_PROFILE_EN )
+
+	/**
+	 * 	Parameter profiles
+	 */
+	static par_profile_t g_par_profile[ PAR_CFG_PROFILE_NUM ] = { 0 };
+
+#endif
+
+#if ( 1 == PAR_CFG_NOTIFY_EN )
+
+	/**
+	 * 	Parameter change subscriptions
+	 */
+	static par_sub_t g_par_sub[ PAR_CFG_NOTIFY_SUB_NUM ] = { 0 };
+
+	/**
+	 * 	Parameters changed since last notification
+	 *
+	 * @note	One bit per parameter number (enumeration). Protected by
+	 * 			the same mutex as live values.
+	 */
+	static uint32_t 		gu32_par_notify_pending[ PAR_NOTIFY_WORD_NUM ] 	= { 0 };
+	static volatile bool	gb_par_notify_pending 							= false;
+
+#endif
 
 #if ( PAR_CFG_DEBUG_EN )
 
@@ -88,23 +630,128 @@ static uint32_t 	gu32_par_addr_offset[ ePAR_NUM_OF ] = { 0 };
 ////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_allocate_ram_space	(uint8_t ** pp_ram_space);
-static uint32_t 	par_calc_ram_usage		(void);
-static par_status_t	par_check_table_validy	(const par_cfg_t * const p_par_cfg);
-static par_status_t par_set_u8				(const par_num_t par_num, const uint8_t u8_val);
-static par_status_t par_set_i8				(const par_num_t par_num, const int8_t i8_val);
-static par_status_t par_set_u16				(const par_num_t par_num, const uint16_t u16_val);
-static par_status_t par_set_i16				(const par_num_t par_num, const int16_t i16_val);
-static par_status_t par_set_u32				(const par_num_t par_num, const uint32_t u32_val);
-static par_status_t par_set_i32				(const par_num_t par_num, const int32_t i32_val);
-static par_status_t par_set_f32				(const par_num_t par_num, const float32_t f32_val);
-static uint8_t      par_get_u8				(const par_num_t par_num);
-static int8_t       par_get_i8				(const par_num_t par_num);
-static uint16_t     par_get_u16				(const par_num_t par_num);
-static int16_t      par_get_i16				(const par_num_t par_num);
-static uint32_t     par_get_u32				(const par_num_t par_num);
-static int32_t      par_get_i32				(const par_num_t par_num);
-static float32_t    par_get_f32				(const par_num_t par_num);
+#if ( 0 == PAR_CFG_STATIC_LAYOUT_EN )
+	static par_status_t par_allocate_ram_space	(uint8_t ** pp_ram_space);
+	static uint32_t 	par_calc_ram_usage		(void);
+	static par_status_t	par_check_table_validy	(void);
+#endif
+static par_status_t par_build_id_lut		(void);
+static par_status_t par_find_id_lut			(const uint16_t id, par_num_t * const p_par_num);
+static par_status_t par_write				(const par_num_t par_num, const void * p_val, const bool fill);
+static par_status_t par_set_value			(const par_num_t par_num, const void * p_val, const bool fill);
+#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+	static par_status_t par_write_def_image	(void);
+#endif
+#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN ) && ( 1 == PAR_CFG_ARRAY_EN )
+	static void			par_fill_arrays		(void);
+#endif
+static inline uint16_t par_get_elem_num		(const par_num_t par_num);
+static inline bool	par_is_isr_safe			(const par_num_t par_num);
+static inline void	par_value_store			(uint8_t * const p_dst, const par_type_t * const p_val, const uint8_t size);
+static inline void	par_value_load			(const uint8_t * const p_src, par_type_t * const p_val, const uint8_t size);
+static void			par_get_value			(const par_num_t par_num, void * const p_val);
+static bool			par_is_batch_valid		(const par_num_t * const p_par_num, const void * const * const pp_val, const uint32_t num);
+static inline void	par_seq_write_begin		(void);
+static inline void	par_seq_write_end		(void);
+static inline void	par_on_change			(const par_num_t par_num);
+static inline void	par_on_change_notify	(const par_num_t par_num);
+#if ( 1 == PAR_CFG_MUTEX_EN )
+	static inline par_status_t par_aquire_mutex	(void);
+	static inline par_status_t par_aquire_mutex_rd	(void);
+	static inline void par_release_mutex_rd		(void);
+
+	#if ( 1 == PAR_CFG_STATS_EN )
+		static inline void par_stats_mutex_add	(const par_status_t status, const uint32_t ts_start);
+	#endif
+#endif
+#if ( 1 == PAR_SHARED_READER_EN )
+	static par_status_t	par_shared_check		(void);
+#elif ( 1 == PAR_CFG_SHARED_EN )
+	static void			par_shared_reset		(void);
+	static void			par_shared_publish		(void);
+#endif
+#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+	static void			par_stats_lat_add		(par_stats_lat_t * const p_lat, const uint32_t lat);
+#endif
+#if ( 1 == PAR_CFG_NVM_EN )
+	static bool			par_dirty_take			(const par_num_t par_num);
+	static uint32_t		par_dirty_take_word		(const uint32_t word);
+	static void			par_dirty_restore		(const par_num_t par_num);
+	static void			par_dirty_restore_word	(const uint32_t word, const uint32_t dirty);
+	static void			par_dirty_clear_all		(void);
+#endif
+#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+	static void			par_loaded_reset		(void);
+	static void			par_load_on_demand		(const par_num_t par_num);
+	static void			par_load_notify			(void);
+#endif
+static inline void		par_loaded_mark			(const par_num_t par_num);
+#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+	static void			par_wb_schedule			(const par_num_t par_num);
+	static par_status_t par_wb_flush			(const bool force);
+
+	#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+		static par_wb_policy_t	par_wb_policy_check	(const par_num_t par_num, const uint32_t now_ms);
+		static void				par_wb_policy_hold	(const par_num_t par_num);
+		static void				par_wb_policy_stored(const par_num_t par_num, const uint32_t now_ms);
+	#endif
+#endif
+#if ( 1 == PAR_CFG_PROFILE_EN ) && ( 1 == PAR_CFG_NVM_EN )
+	static void			par_profile_load_all	(void);
+#endif
+#if ( 1 == PAR_CFG_NOTIFY_EN )
+	static uint32_t		par_notify_take_word	(const uint32_t word);
+	static void			par_notify_dispatch		(void);
+	static void			par_notify_clear_all	(void);
+#endif
+static int32_t		par_type_cmp_u8			(const par_type_t * const p_a, const par_type_t * const p_b);
+static int32_t		par_type_cmp_i8			(const par_type_t * const p_a, const par_type_t * const p_b);
+static int32_t		par_type_cmp_u16		(const par_type_t * const p_a, const par_type_t * const p_b);
+static int32_t		par_type_cmp_i16		(const par_type_t * const p_a, const par_type_t * const p_b);
+static int32_t		par_type_cmp_u32		(const par_type_t * const p_a, const par_type_t * const p_b);
+static int32_t		par_type_cmp_i32		(const par_type_t * const p_a, const par_type_t * const p_b);
+static int32_t		par_type_cmp_f32		(const par_type_t * const p_a, const par_type_t * const p_b);
+#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+	static int32_t	par_type_cmp_u64		(const par_type_t * const p_a, const par_type_t * const p_b);
+	static int32_t	par_type_cmp_i64		(const par_type_t * const p_a, const par_type_t * const p_b);
+#endif
+#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN ) && ( 1 == PAR_CFG_NVM_POLICY_EN )
+	static bool		par_type_delta_u8		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+	static bool		par_type_delta_i8		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+	static bool		par_type_delta_u16		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+	static bool		par_type_delta_i16		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+	static bool		par_type_delta_u32		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+	static bool		par_type_delta_i32		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+	static bool		par_type_delta_f32		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		static bool	par_type_delta_u64		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+		static bool	par_type_delta_i64		(const par_type_t * const p_a, const par_type_t * const p_b, const par_type_t * const p_th);
+	#endif
+#endif
+
+/**
+ * 	Data type descriptors
+ *
+ * @note	Q15 and Q31 raw values are compared as signed integers.
+ */
+static const par_type_desc_t g_par_type_desc[ ePAR_TYPE_NUM_OF ] =
+{
+	[ePAR_TYPE_U8]	= { .pf_cmp = par_type_cmp_u8,	.size = sizeof( uint8_t ),		.align = sizeof( uint8_t )	PAR_TYPE_DELTA( u8 )	},
+	[ePAR_TYPE_U16]	= { .pf_cmp = par_type_cmp_u16,	.size = sizeof( uint16_t ),		.align = sizeof( uint16_t )	PAR_TYPE_DELTA( u16 )	},
+	[ePAR_TYPE_U32]	= { .pf_cmp = par_type_cmp_u32,	.size = sizeof( uint32_t ),		.align = sizeof( uint32_t )	PAR_TYPE_DELTA( u32 )	},
+	[ePAR_TYPE_I8]	= { .pf_cmp = par_type_cmp_i8,	.size = sizeof( int8_t ),		.align = sizeof( int8_t )	PAR_TYPE_DELTA( i8 )	},
+	[ePAR_TYPE_I16]	= { .pf_cmp = par_type_cmp_i16,	.size = sizeof( int16_t ),		.align = sizeof( int16_t )	PAR_TYPE_DELTA( i16 )	},
+	[ePAR_TYPE_I32]	= { .pf_cmp = par_type_cmp_i32,	.size = sizeof( int32_t ),		.align = sizeof( int32_t )	PAR_TYPE_DELTA( i32 )	},
+	[ePAR_TYPE_F32]	= { .pf_cmp = par_type_cmp_f32,	.size = sizeof( float32_t ),	.align = sizeof( float32_t )	PAR_TYPE_DELTA( f32 )	},
+	[ePAR_TYPE_Q15]	= { .pf_cmp = par_type_cmp_i16,	.size = sizeof( par_q15_t ),	.align = sizeof( par_q15_t )	PAR_TYPE_DELTA( i16 )	},
+	[ePAR_TYPE_Q31]	= { .pf_cmp = par_type_cmp_i32,	.size = sizeof( par_q31_t ),	.align = sizeof( par_q31_t )	PAR_TYPE_DELTA( i32 )	},
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		[ePAR_TYPE_U64]	= { .pf_cmp = par_type_cmp_u64,	.size = sizeof( uint64_t ),	.align = sizeof( uint64_t )	PAR_TYPE_DELTA( u64 )	},
+		[ePAR_TYPE_I64]	= { .pf_cmp = par_type_cmp_i64,	.size = sizeof( int64_t ),	.align = sizeof( int64_t )	PAR_TYPE_DELTA( i64 )	},
+	#endif
+};
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -128,19 +775,40 @@ par_status_t par_init(void)
     if ( false == gb_is_init )
     {
     	// Get parameter table
-    	gp_par_table = par_cfg_get_table();
-    	PAR_ASSERT( NULL != gp_par_table );
+    	#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+    		gp_par_table_hot 	= par_cfg_get_table_hot();
+    		gp_par_table_def 	= par_cfg_get_table_def();
+    		gp_par_table_cold 	= par_cfg_get_table_cold();
+    		PAR_ASSERT(( NULL != gp_par_table_hot ) && ( NULL != gp_par_table_def ) && ( NULL != gp_par_table_cold ));
+    	#else
+    		gp_par_table = par_cfg_get_table();
+    		PAR_ASSERT( NULL != gp_par_table );
+    	#endif
 
     	// Check if par table is defined correctly
-    	status |= par_check_table_validy( gp_par_table );
+    	#if ( 0 == PAR_CFG_STATIC_LAYOUT_EN )
+    		status |= par_check_table_validy();
+    	#endif
+
+    	// Build ID look-up table
+    	status |= par_build_id_lut();
 
     	// Allocate space in RAM
-    	status |= par_allocate_ram_space( &gpu8_par_value );
-    	PAR_ASSERT( NULL != gpu8_par_value );
+    	#if ( 0 == PAR_CFG_STATIC_LAYOUT_EN )
+    		status |= par_allocate_ram_space( &gpu8_par_value );
+    		PAR_ASSERT( NULL != gpu8_par_value );
+    	#endif
 
     	// Initialize parameter interface
     	status |= par_if_init();
 
+    	// Live values are owned by other core
+    	#if ( 1 == PAR_SHARED_READER_EN )
+    		status |= par_shared_check();
+    	#elif ( 1 == PAR_CFG_SHARED_EN )
+    		par_shared_reset();
+    	#endif
+
     	// Init succeed
     	if ( ePAR_OK == status )
     	{
@@ -148,13 +816,48 @@ par_status_t par_init(void)
     	}
 
     	// Set all parameters to default
-    	par_set_all_to_default();
+    	#if ( 1 == PAR_SHARED_READER_EN )
+    		// No actions...
+    	#elif ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+    		memcpy( gpu8_par_value, gpu8_par_def_image, sizeof( par_layout_t ));
+
+    		#if ( 1 == PAR_CFG_ARRAY_EN )
+    			par_fill_arrays();
+    		#endif
+
+    		PAR_DBG_PRINT( "PAR: Setting all parameters to default" );
+    	#else
+    		par_set_all_to_default();
+    	#endif
 
     	#if ( 1 == PAR_CFG_NVM_EN )
 
+    		// Persistent parameters are not loaded yet
+    		#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+    			par_loaded_reset();
+    		#endif
+
     		// Init and load parameters from NVM
     		status |= par_nvm_init();
 
+    		// Values are now in sync with NVM
+    		par_dirty_clear_all();
+
+    	#endif
+
+    	// Load stored profiles
+    	#if ( 1 == PAR_CFG_PROFILE_EN ) && ( 1 == PAR_CFG_NVM_EN )
+    		par_profile_load_all();
+    	#endif
+
+    	// Drop notifications of values set at init
+    	#if ( 1 == PAR_CFG_NOTIFY_EN )
+    		par_notify_clear_all();
+    	#endif
+
+    	// Let other cores in
+    	#if ( 1 == PAR_CFG_SHARED_EN ) && ( 0 == PAR_SHARED_READER_EN )
+    		par_shared_publish();
     	#endif
 
     	PAR_DBG_PRINT( "PAR: Parameters initialized with status: %s", par_get_status_str( status ));
@@ -186,6 +889,10 @@ par_status_t par_deinit(void)
     		status |= par_nvm_deinit();
 
     	#endif
+
+    	#if ( 1 == PAR_CFG_SHARED_EN ) && ( 0 == PAR_SHARED_READER_EN )
+    		PAR_CFG_SHARED_SYMBOL.ready = 0UL;
+    	#endif
         
         // Module de-initialized
         gb_is_init = false;
@@ -236,6 +943,9 @@ par_status_t par_is_init(bool * const p_is_init)
 * @note		Input is parameter number (enumeration) defined in par_cfg.h and not
 * 			parameter ID number!
 *
+* @note		For array parameter "p_val" points to all elements, each of
+* 			them is limited to parameter range.
+*
 * @param[in]	par_num	- Parameter number (enumeration)
 * @param[in]	p_val	- Pointer to value
 * @return		status 	- Status of operation
@@ -245,6 +955,14 @@ par_status_t par_set(const par_num_t par_num, const void * p_val)
 {
 	par_status_t status = ePAR_OK;
 
+	#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+		const uint32_t ts_start = par_if_get_ts();
+	#endif
+
+	#if ( 1 == PAR_CFG_STATS_EN )
+		g_par_stats.set_cnt++;
+	#endif
+
 	// Is init
 	PAR_ASSERT( true == gb_is_init );
 
@@ -255,56 +973,7 @@ par_status_t par_set(const par_num_t par_num, const void * p_val)
 	{
 		if ( par_num < ePAR_NUM_OF )
 		{
-			#if ( 1 == PAR_CFG_MUTEX_EN )
-				if ( ePAR_OK == par_if_aquire_mutex())
-				{
-			#endif
-					switch ( gp_par_table[ par_num ].type )
-					{
-						case ePAR_TYPE_U8:
-							status = par_set_u8( par_num, *(uint8_t*) p_val );
-							break;
-
-						case ePAR_TYPE_I8:
-							status = par_set_i8( par_num, *(int8_t*) p_val );
-							break;
-
-						case ePAR_TYPE_U16:
-							status = par_set_u16( par_num, *(uint16_t*) p_val );
-							break;
-
-						case ePAR_TYPE_I16:
-							status = par_set_i16( par_num, *(int16_t*) p_val );
-							break;
-
-						case ePAR_TYPE_U32:
-							status = par_set_u32( par_num, *(uint32_t*) p_val );
-							break;
-
-						case ePAR_TYPE_I32:
-							status = par_set_i32( par_num, *(int32_t*) p_val );
-							break;
-
-						case ePAR_TYPE_F32:
-							status = par_set_f32( par_num, *(float32_t*) p_val );
-							break;
-
-						case ePAR_TYPE_NUM_OF:
-						default:
-							PAR_ASSERT( 0 );
-							break;
-					}
-
-			#if ( 1 == PAR_CFG_MUTEX_EN )
-					par_if_release_mutex();
-				}
-
-				// Mutex not acquire
-				else
-				{
-					status = ePAR_ERROR;
-				}
-			#endif
+			status = par_write( par_num, p_val, false );
 		}
 		else
 		{
@@ -316,6 +985,10 @@ par_status_t par_set(const par_num_t par_num, const void * p_val)
 		status = ePAR_ERROR_INIT;
 	}
 
+	#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+		par_stats_lat_add( &g_par_stats.set_lat, ( par_if_get_ts() - ts_start ));
+	#endif
+
 	return status;
 }
 
@@ -340,7 +1013,7 @@ par_status_t par_set_to_default(const par_num_t par_num)
 	{
 		if ( par_num < ePAR_NUM_OF )
 		{
-            status |= par_set(par_num, &gp_par_table[par_num].def);
+            status |= par_write( par_num, &PAR_CFG_DEF( par_num ), true );
 		}
 		else
 		{
@@ -367,16 +1040,19 @@ par_status_t par_set_to_default(const par_num_t par_num)
 par_status_t par_set_all_to_default(void)
 {
 	par_status_t	status 	= ePAR_OK;
-	uint32_t 		par_num = 0UL;
 
 	PAR_ASSERT( true == gb_is_init );
 
 	if ( true == gb_is_init )
 	{
-		for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
-		{
-			par_set_to_default( par_num );
-		}
+		#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+			status = par_write_def_image();
+		#else
+			for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+			{
+				par_set_to_default( par_num );
+			}
+		#endif
 
 		PAR_DBG_PRINT( "PAR: Setting all parameters to default" );
 	}
@@ -409,41 +1085,28 @@ par_status_t par_has_changed(const par_num_t par_num, bool *const p_has_changed)
 		&&	( NULL != p_has_changed )
         &&  ( ePAR_NUM_OF > par_num ))
 	{
-        switch ( gp_par_table[par_num].type )
-        {
-            case ePAR_TYPE_U8:
-                *p_has_changed = (par_get_u8(par_num) != gp_par_table[par_num].def.u8);
-                break;
-
-            case ePAR_TYPE_I8:
-                *p_has_changed = (par_get_i8(par_num) != gp_par_table[par_num].def.i8);
-                break;
+		const	uint8_t * 	p_val 		= &gpu8_par_value[ g_par_addr_offset[par_num] ];
+		const	uint8_t		size		= g_par_type_desc[ PAR_CFG_HOT( par_num ).type ].size;
+		const	uint16_t	elem_num	= par_get_elem_num( par_num );
 
-            case ePAR_TYPE_U16:
-                *p_has_changed = (par_get_u16(par_num) != gp_par_table[par_num].def.u16);
-                break;
+		// Compare with default values image
+		#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+			const uint8_t * const p_def = &gpu8_par_def_image[ g_par_addr_offset[par_num] ];
+		#else
+			const uint8_t * const p_def = (const uint8_t*) &PAR_CFG_DEF( par_num );
+		#endif
 
-            case ePAR_TYPE_I16:
-                *p_has_changed = (par_get_i16(par_num) != gp_par_table[par_num].def.i16);
-                break;
+		*p_has_changed = false;
 
-            case ePAR_TYPE_U32:
-                *p_has_changed = (par_get_u32(par_num) != gp_par_table[par_num].def.u32);
-                break;
-
-            case ePAR_TYPE_I32:
-                *p_has_changed = (par_get_i32(par_num) != gp_par_table[par_num].def.i32);
-                break;
-
-            case ePAR_TYPE_F32:
-                *p_has_changed = (par_get_f32(par_num) != gp_par_table[par_num].def.f32);
-                break;
-
-            case ePAR_TYPE_NUM_OF:
-            default:
-                PAR_ASSERT( 0 );
-                break;
-        }
+		// Any of elements differs from default
+		for ( uint16_t elem = 0U; elem < elem_num; elem++ )
+		{
+			if ( 0 != memcmp( &p_val[ elem * size ], p_def, size ))
+			{
+				*p_has_changed = true;
+				break;
+			}
+		}
 	}
 	else
 	{
@@ -467,6 +1130,8 @@ par_status_t par_has_changed(const par_num_t par_num, bool *const p_has_changed)
 * @note		Input is parameter number (enumeration) defined in par_cfg.h and not
 * 			parameter ID number!
 *
+* @note		For array parameter all elements are copied, see "par_get_len()".
+*
 * @param[in]	par_num	- Parameter number (enumeration)
 * @param[out]	p_val	- Parameter value
 * @return		status 	- Status of operation
@@ -476,54 +1141,33 @@ par_status_t par_get(const par_num_t par_num, void * const p_val)
 {
 	par_status_t status = ePAR_OK;
 
+	#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+		const uint32_t ts_start = par_if_get_ts();
+	#endif
+
+	#if ( 1 == PAR_CFG_STATS_EN )
+		g_par_stats.get_cnt++;
+	#endif
+
 	// Is init
 	PAR_ASSERT( true == gb_is_init );
 
 	// Check input
 	PAR_ASSERT( par_num < ePAR_NUM_OF );
 
+	// Load value from NVM on first access
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		par_load_on_demand( par_num );
+	#endif
+
 	#if ( 1 == PAR_CFG_MUTEX_EN )
-		if ( ePAR_OK == par_if_aquire_mutex())
+		if ( ePAR_OK == par_aquire_mutex_rd())
 		{
 	#endif
-			switch ( gp_par_table[par_num].type )
-			{
-				case ePAR_TYPE_U8:
-					*(uint8_t*) p_val = par_get_u8(par_num);
-					break;
-
-				case ePAR_TYPE_I8:
-					*(int8_t*) p_val = par_get_i8(par_num);
-					break;
-
-				case ePAR_TYPE_U16:
-					*(uint16_t*) p_val = par_get_u16(par_num);
-					break;
-
-				case ePAR_TYPE_I16:
-					*(int16_t*) p_val = par_get_i16(par_num);
-					break;
-
-				case ePAR_TYPE_U32:
-					*(uint32_t*) p_val = par_get_u32(par_num);
-					break;
-
-				case ePAR_TYPE_I32:
-					*(int32_t*) p_val = par_get_i32(par_num);
-					break;
-
-				case ePAR_TYPE_F32:
-					*(float32_t*) p_val = par_get_f32(par_num);
-					break;
-
-				case ePAR_TYPE_NUM_OF:
-				default:
-					PAR_ASSERT( 0 );
-					break;
-			}
+			par_get_value( par_num, p_val );
 
 	#if ( 1 == PAR_CFG_MUTEX_EN )
-			par_if_release_mutex();
+			par_release_mutex_rd();
 		}
 
 		// Mutex not acquire
@@ -533,41 +1177,65 @@ par_status_t par_get(const par_num_t par_num, void * const p_val)
 		}
 	#endif
 
+	#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+		par_stats_lat_add( &g_par_stats.get_lat, ( par_if_get_ts() - ts_start ));
+	#endif
+
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Get parameter ID
+*		Get parameter value from interrupt context
+*
+* @note		Lock-free, does not take mutex, thus can be called from ISR, or
+* 			from other core when values buffer is shared. Only scalar
+* 			parameters of up to 32-bit are supported, as their value is
+* 			read with single aligned load that can not be torn.
+*
+* 			Barrier after load orders it before any following read, pairs
+* 			with barrier in "par_set_isr()".
+*
+* @pre	Parameters must be initialised before usage!
 *
 * @param[in]	par_num	- Parameter number (enumeration)
-* @param[out]	p_id 	- Pointer to parameter ID
-* @return		status	- Status of operation
+* @param[out]	p_val	- Parameter value
+* @return		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-par_status_t par_get_id(const par_num_t par_num, uint16_t * const p_id)
+par_status_t par_get_isr(const par_num_t par_num, void * const p_val)
 {
-	par_status_t status = ePAR_OK;
+	par_status_t	status	= ePAR_OK;
+	par_type_t		val		= { 0 };
 
+	// Is init
 	PAR_ASSERT( true == gb_is_init );
+
+	// Check input
 	PAR_ASSERT( par_num < ePAR_NUM_OF );
-	PAR_ASSERT( NULL != p_id );
+	PAR_ASSERT( NULL != p_val );
 
-	if ( true == gb_is_init )
+	if ( true != gb_is_init )
 	{
-		if ( 	( par_num < ePAR_NUM_OF )
-			&&	( NULL != p_id  ))
-		{
-			*p_id = gp_par_table[ par_num ].id;
-		}
-		else
-		{
-			status = ePAR_ERROR;
-		}
+		status = ePAR_ERROR_INIT;
+	}
+	else if (	( par_num >= ePAR_NUM_OF )
+			||	( NULL == p_val )
+			||	( true != par_is_isr_safe( par_num )))
+	{
+		status = ePAR_ERROR;
 	}
 	else
 	{
-		status = ePAR_ERROR_INIT;
+		// Loading is not triggered from ISR, value might still be default
+		#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+			PAR_ASSERT( 0UL != ( gu32_par_loaded[ par_num / 32U ] & ( 1UL << ( par_num % 32U ))));
+		#endif
+
+		par_value_load( &gpu8_par_value[ g_par_addr_offset[par_num] ], &val, g_par_type_desc[ PAR_CFG_HOT( par_num ).type ].size );
+		PAR_MEMORY_BARRIER();
+
+		memcpy( p_val, &val, g_par_type_desc[ PAR_CFG_HOT( par_num ).type ].size );
 	}
 
 	return status;
@@ -575,50 +1243,83 @@ par_status_t par_get_id(const par_num_t par_num, uint16_t * const p_id)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Get parameter number (enumeration) by ID
+*		Set parameter value from interrupt context
 *
-* @param[in]	id 			- Parameter ID
-* @param[out]	p_par_num	- Pointer to parameter enumeration number
-* @return		status		- Status of operation
+* @note		Wait-free, does not take mutex, thus can be called from ISR.
+* 			Value is limited to parameter range and published with single
+* 			aligned store after barrier, so that reader on any core which
+* 			observes new value also observes all writes made before.
+*
+* 			Single writer: parameter set from ISR shall not be set from
+* 			any other context, and "par_set_isr()" calls shall not preempt
+* 			each other (e.g. ISRs of the same priority).
+*
+* 			Value is only published: parameter is not marked for storing
+* 			to NVM, change sequence is not updated and subscribers are not
+* 			notified. Only scalar parameters of up to 32-bit are supported.
+*
+* @pre	Parameters must be initialised before usage!
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @param[in]	p_val	- Pointer to value
+* @return		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-par_status_t par_get_num_by_id(const uint16_t id, par_num_t * const p_par_num)
+par_status_t par_set_isr(const par_num_t par_num, const void * p_val)
 {
-	par_status_t 	status 	= ePAR_OK;
-	uint16_t 		par_num = 0UL;
-	bool			found	= false;
+	par_status_t status = ePAR_OK;
 
+	// Is init
 	PAR_ASSERT( true == gb_is_init );
-	PAR_ASSERT( NULL != p_par_num );
 
-	if ( true == gb_is_init )
+	// Check input
+	PAR_ASSERT( par_num < ePAR_NUM_OF );
+	PAR_ASSERT( NULL != p_val );
+
+	if ( true != gb_is_init )
 	{
-		if ( NULL != p_par_num )
-		{
-			for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
-			{
-				if ( gp_par_table[par_num].id == id )
-				{
-					*p_par_num = par_num;
-					found = true;
-					break;
-				}
-			}
+		status = ePAR_ERROR_INIT;
+	}
+	else if (	( par_num >= ePAR_NUM_OF )
+			||	( NULL == p_val )
+			||	( true != par_is_isr_safe( par_num ))
+			||	( 1 == PAR_SHARED_READER_EN ))
+	{
+		status = ePAR_ERROR;
+	}
+	else
+	{
+		const	par_type_desc_t * const	p_desc	= &g_par_type_desc[ PAR_CFG_HOT( par_num ).type ];
+				par_type_t				val		= { 0 };
 
-			// Does parameter with requested ID even exist
-			if ( false == found )
-			{
-				status = ePAR_ERROR;
-			}
+		memcpy( &val, p_val, p_desc->size );
+
+		// Limit to range
+		if ( p_desc->pf_cmp( &val, &PAR_CFG_HOT( par_num ).max ) > 0 )
+		{
+			val = PAR_CFG_HOT( par_num ).max;
+		}
+		else if ( p_desc->pf_cmp( &val, &PAR_CFG_HOT( par_num ).min ) < 0 )
+		{
+			val = PAR_CFG_HOT( par_num ).min;
 		}
 		else
 		{
-			status = ePAR_ERROR;
+			// No actions...
 		}
-	}
-	else
-	{
-		status = ePAR_ERROR_INIT;
+
+		#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+			gp_par_seq->isr_seq = gp_par_seq->isr_seq + 1U;
+		#endif
+
+		// Publish
+		PAR_MEMORY_BARRIER();
+		par_value_store( &gpu8_par_value[ g_par_addr_offset[par_num] ], &val, p_desc->size );
+		PAR_MEMORY_BARRIER();
+
+		#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+			gp_par_seq->isr_seq = gp_par_seq->isr_seq + 1U;
+		#endif
 	}
 
 	return status;
@@ -626,31 +1327,81 @@ par_status_t par_get_num_by_id(const uint16_t id, par_num_t * const p_par_num)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Get parameter configurations
+*		Set multiple parameter values at once
 *
-* @param[in]	par_num		- Parameter number (enumeration)
-* @param[out]	p_par_cfg	- Pointer to parameter configurations
+* @brief	All parameters are set under single mutex acquisition, therefore
+* 			other tasks can never see only part of the group being changed.
+*
+* 			All inputs are validated before any value is applied, so either
+* 			all values are set (clamped to its range as with "par_set()") or
+* 			none of them.
+*
+* @code
+* 			const par_num_t par_num[3]	= { ePAR_PID_KP, ePAR_PID_KI, ePAR_PID_KD };
+* 			const void * 	p_val[3]	= { &kp, &ki, &kd };
+*
+* 			par_set_batch( par_num, p_val, 3 );
+* @endcode
+*
+* @param[in]	p_par_num	- Pointer to parameter numbers (enumerations)
+* @param[in]	pp_val		- Pointer to parameter value pointers
+* @param[in]	num			- Number of parameters
 * @return		status 		- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-par_status_t par_get_config(const par_num_t par_num, par_cfg_t * const p_par_cfg)
+par_status_t par_set_batch(const par_num_t * const p_par_num, const void * const * const pp_val, const uint32_t num)
 {
-			par_status_t 	status 		= ePAR_OK;
-	const 	par_cfg_t * 	p_cfg_table	= par_cfg_get_table();
+	par_status_t status = ePAR_OK;
 
-	PAR_ASSERT( NULL != p_cfg_table );
-	PAR_ASSERT( NULL != p_par_cfg );
-	PAR_ASSERT( par_num < ePAR_NUM_OF );
+	#if ( 1 == PAR_CFG_STATS_EN )
+		g_par_stats.set_batch_cnt++;
+	#endif
 
-	if ( 	( NULL != p_par_cfg )
-		&& 	( NULL != p_cfg_table )
-		&&	( par_num < ePAR_NUM_OF ))
+	PAR_ASSERT( true == gb_is_init );
+	PAR_ASSERT( true == par_is_batch_valid( p_par_num, pp_val, num ));
+
+	if ( true == gb_is_init )
 	{
-		*p_par_cfg = p_cfg_table[ par_num ];
+		if 	(	( true == par_is_batch_valid( p_par_num, pp_val, num ))
+			&&	( 0 == PAR_SHARED_READER_EN ))
+		{
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					par_seq_write_begin();
+
+					for ( uint32_t i = 0; i < num; i++ )
+					{
+						status |= par_set_value( p_par_num[i], pp_val[i], false );
+					}
+
+					par_seq_write_end();
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			#endif
+
+			// Notify subscribers (outside of mutex)
+			#if ( 1 == PAR_CFG_NOTIFY_EN ) && ( 0 == PAR_CFG_NOTIFY_DEFER_EN )
+				par_notify_dispatch();
+			#endif
+		}
+		else
+		{
+			status = ePAR_ERROR;
+		}
 	}
 	else
 	{
-		status = ePAR_ERROR;
+		status = ePAR_ERROR_INIT;
 	}
 
 	return status;
@@ -658,225 +1409,177 @@ par_status_t par_get_config(const par_num_t par_num, par_cfg_t * const p_par_cfg
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Get parameter type size
+*		Get multiple parameter values at once
 *
-* @param[in]	type		- Data type of parameter
-* @param[out]	p_size		- Pointer to parameter data type size
+* @brief	All parameters are read under single mutex acquisition, thus
+* 			values are consistent snapshot of the group.
+*
+* @param[in]	p_par_num	- Pointer to parameter numbers (enumerations)
+* @param[out]	pp_val		- Pointer to parameter value pointers
+* @param[in]	num			- Number of parameters
 * @return		status 		- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-par_status_t par_get_type_size(const par_type_list_t type, uint8_t * const p_size)
+par_status_t par_get_batch(const par_num_t * const p_par_num, void * const * const pp_val, const uint32_t num)
 {
 	par_status_t status = ePAR_OK;
 
-	PAR_ASSERT( type < ePAR_TYPE_NUM_OF );
-	PAR_ASSERT( NULL != p_size );
+	#if ( 1 == PAR_CFG_STATS_EN )
+		g_par_stats.get_batch_cnt++;
+	#endif
 
-	if ( 	( type < ePAR_TYPE_NUM_OF )
-		&&	( NULL != p_size ))
+	PAR_ASSERT( true == gb_is_init );
+	PAR_ASSERT( true == par_is_batch_valid( p_par_num, (const void * const *) pp_val, num ));
+
+	if ( true == gb_is_init )
 	{
-		switch ( type )
+		if ( true == par_is_batch_valid( p_par_num, (const void * const *) pp_val, num ))
 		{
-			case ePAR_TYPE_U8:
-				*p_size = sizeof( uint8_t );
-				break;
-
-			case ePAR_TYPE_I8:
-				*p_size = sizeof( int8_t );
-				break;
-
-			case ePAR_TYPE_U16:
-				*p_size = sizeof( uint16_t );
-				break;
-
-			case ePAR_TYPE_I16:
-				*p_size = sizeof( int16_t );
-				break;
-
-			case ePAR_TYPE_U32:
-				*p_size = sizeof( uint32_t );
-				break;
+			// Load values from NVM on first access
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				for ( uint32_t i = 0; i < num; i++ )
+				{
+					par_load_on_demand( p_par_num[i] );
+				}
+			#endif
 
-			case ePAR_TYPE_I32:
-				*p_size = sizeof( int32_t );
-				break;
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex_rd())
+				{
+			#endif
+					for ( uint32_t i = 0; i < num; i++ )
+					{
+						par_get_value( p_par_num[i], pp_val[i] );
+					}
 
-			case ePAR_TYPE_F32:
-				*p_size = sizeof( float32_t );
-				break;
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_release_mutex_rd();
+				}
 
-			case ePAR_TYPE_NUM_OF:
-			default:
-				status = ePAR_ERROR;
-				break;
+				// Mutex not acquire
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			#endif
+		}
+		else
+		{
+			status = ePAR_ERROR;
 		}
 	}
 	else
 	{
-		status = ePAR_ERROR;
+		status = ePAR_ERROR_INIT;
 	}
 
 	return status;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Get parameter type
-*
-* @param[in]	par_num	- Parameter number (enumeration)
-* @param[out]	p_type 	- Pointer to parameter type
-* @return		status	- Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-par_status_t par_get_type(const par_num_t par_num, par_type_list_t *const p_type)
-{
-	par_status_t status = ePAR_OK;
-
-	PAR_ASSERT( true == gb_is_init );
-	PAR_ASSERT( NULL != p_type );
-    PAR_ASSERT( ePAR_NUM_OF > par_num );
-
-	if ( 	( true == gb_is_init )
-		&&	( NULL != p_type )
-        &&  ( ePAR_NUM_OF > par_num ))
-	{
-        *p_type = gp_par_table[par_num].type;
-	}
-	else
-	{
-		status = ePAR_ERROR;
-	}
-
-	return status;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Get parameter value range
-*
-* @param[in]	par_num	- Parameter number (enumeration)
-* @param[out]	p_type 	- Pointer to value range
-* @return		status	- Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-par_status_t par_get_range(const par_num_t par_num, par_range_t *const p_range)
-{
-	par_status_t status = ePAR_OK;
-
-	PAR_ASSERT( true == gb_is_init );
-	PAR_ASSERT( NULL != p_range );
-    PAR_ASSERT( ePAR_NUM_OF > par_num );
-
-	if ( 	( true == gb_is_init )
-		&&	( NULL != p_range )
-        &&  ( ePAR_NUM_OF > par_num ))
-	{
-        p_range->min = gp_par_table[par_num].min;
-        p_range->max = gp_par_table[par_num].max;
-	}
-	else
-	{
-		status = ePAR_ERROR;
-	}
-
-	return status;
-}
-
-#if ( 1 == PAR_CFG_NVM_EN )
-    ////////////////////////////////////////////////////////////////////////////////
-    /**
-    *		Set parameter value and save to NVM if value changed
-    *
-    * @note 	Mandatory to cast input argument to appropriate type. E.g.:
-    *
-    * @code
-    * 			float32_t my_val = 1.234f;
-    * 			par_set( ePAR_MY_VAR, (float32_t*) &my_val );
-    * @endcode
-    *
-    * @note		Input is parameter number (enumeration) defined in par_cfg.h and not
-    * 			parameter ID number!
-    *
-    * @param[in]	par_num	- Parameter number (enumeration)
-    * @param[in]	p_val	- Pointer to value
-    * @return		status 	- Status of operation
-    */
-    ////////////////////////////////////////////////////////////////////////////////
-    par_status_t par_set_n_save(const par_num_t par_num, const void * p_val)
-    {
-    	par_status_t status = ePAR_OK;
-
-    	// Is init
-    	PAR_ASSERT( true == gb_is_init );
-
-    	// Check input
-    	PAR_ASSERT( par_num < ePAR_NUM_OF );
-
-        bool has_value_changed = false;
-        switch ( gp_par_table[ par_num ].type )
-        {
-            case ePAR_TYPE_U8:
-                has_value_changed = (par_get_u8(par_num) != *(uint8_t*)p_val);
-                break;
-
-            case ePAR_TYPE_I8:
-                has_value_changed = (par_get_i8(par_num) != *(int8_t*)p_val);
-                break;
-
-            case ePAR_TYPE_U16:
-                has_value_changed = (par_get_u16(par_num) != *(uint16_t*)p_val);
-                break;
-
-            case ePAR_TYPE_I16:
-                has_value_changed = (par_get_i16(par_num) != *(int16_t*)p_val);
-                break;
-
-            case ePAR_TYPE_U32:
-                has_value_changed = (par_get_u32(par_num) != *(uint32_t*)p_val);
-                break;
-
-            case ePAR_TYPE_I32:
-                has_value_changed = (par_get_i32(par_num) != *(int32_t*)p_val);
-                break;
-
-            case ePAR_TYPE_F32:
-                has_value_changed = (par_get_f32(par_num) != *(float32_t*)p_val);
-                break;
-
-            case ePAR_TYPE_NUM_OF:
-            default:
-                PAR_ASSERT( 0 );
-                break;
-        }
-
-        status |= par_set(par_num, p_val);
-        if ((ePAR_OK == status) && has_value_changed)
-        {
-            status |= par_save(par_num);
-        }
-
-    	return status;
-    }
+#if ( 1 == PAR_CFG_SNAPSHOT_EN )
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Store all parameters value to NVM
+	*		Get snapshot of all parameter values
 	*
-	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
-	* 			settings must be enabled.
+	* @brief	Complete live values buffer is copied into caller buffer with
+	* 			single copy. Consistency is guaranteed by sequence counter,
+	* 			when concurrent write is detected copy is repeated. Writers are
+	* 			never blocked by this function.
 	*
-	* @return		status 	- Status of operation
+	* 			Value of parameter inside snapshot is found at its address offset:
+	*
+	* @code
+	* 			const par_addr_offset_t * p_offset = NULL;
+	*
+	* 			par_snapshot( buf, sizeof( buf ), &p_offset );
+	* 			f32 = *(float32_t*) &buf[ p_offset[ePAR_MY_VAR] ];
+	* @endcode
+	*
+	* @note		Use "par_get_snapshot_size()" to get required buffer size.
+	*
+	* @param[out]	p_buf			- Pointer to snapshot buffer
+	* @param[in]	size			- Size of snapshot buffer in bytes
+	* @param[out]	pp_addr_offset	- Pointer to parameter address offsets table, can be NULL
+	* @return		status 			- Status of operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_save_all(void)
+	par_status_t par_snapshot(void * const p_buf, const uint32_t size, const par_addr_offset_t ** const pp_addr_offset)
 	{
-		par_status_t status = ePAR_OK;
+		par_status_t 	status 	= ePAR_OK;
+		uint32_t		seq		= 0UL;
+		uint32_t		isr_seq	= 0UL;
+		bool			done	= false;
 
 		PAR_ASSERT( true == gb_is_init );
+		PAR_ASSERT( NULL != p_buf );
+		PAR_ASSERT( size >= gu32_par_value_size );
 
 		if ( true == gb_is_init )
 		{
-			status = par_nvm_write_all();
+			if 	(	( NULL != p_buf )
+				&&	( size >= gu32_par_value_size ))
+			{
+				for ( uint32_t i = 0; i < PAR_CFG_SNAPSHOT_RETRY_NUM; i++ )
+				{
+					seq 	= gp_par_seq->seq;
+					isr_seq	= gp_par_seq->isr_seq;
+					PAR_MEMORY_BARRIER();
+
+					// No write in progress
+					if ( 0U == (( seq | isr_seq ) & 1U ))
+					{
+						memcpy( p_buf, gpu8_par_value, gu32_par_value_size );
+						PAR_MEMORY_BARRIER();
+
+						// No write during copy
+						if 	(	( seq == gp_par_seq->seq )
+							&&	( isr_seq == gp_par_seq->isr_seq ))
+						{
+							done = true;
+							break;
+						}
+					}
+				}
+
+				// Writer too busy -> take snapshot under mutex
+				if ( false == done )
+				{
+					#if ( 1 == PAR_CFG_MUTEX_EN )
+						if ( ePAR_OK == par_aquire_mutex_rd())
+						{
+							// Writes from ISR are not blocked by mutex
+							do
+							{
+								isr_seq = gp_par_seq->isr_seq;
+								PAR_MEMORY_BARRIER();
+								memcpy( p_buf, gpu8_par_value, gu32_par_value_size );
+								PAR_MEMORY_BARRIER();
+							}
+							while (( 0U != ( isr_seq & 1U )) || ( isr_seq != gp_par_seq->isr_seq ));
+
+							par_release_mutex_rd();
+						}
+
+						// Mutex not acquire
+						else
+						{
+							status = ePAR_ERROR;
+						}
+					#else
+						status = ePAR_ERROR;
+					#endif
+				}
+
+				if ( NULL != pp_addr_offset )
+				{
+					*pp_addr_offset = g_par_addr_offset;
+				}
+			}
+			else
+			{
+				status = ePAR_ERROR;
+			}
 		}
 		else
 		{
@@ -888,24 +1591,29 @@ par_status_t par_get_range(const par_num_t par_num, par_range_t *const p_range)
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Store single parameter value to NVM
-	*
-	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
-	* 			settings must be enabled.
+	*		Get size of parameter values snapshot
 	*
-	* @param[in]	par_num	- Parameter number (enumeration)
-	* @return		status 	- Status of operation
+	* @param[out]	p_size	- Pointer to snapshot size in bytes
+	* @return		status	- Status of operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_save(const par_num_t par_num)
+	par_status_t par_get_snapshot_size(uint32_t * const p_size)
 	{
 		par_status_t status = ePAR_OK;
 
 		PAR_ASSERT( true == gb_is_init );
+		PAR_ASSERT( NULL != p_size );
 
 		if ( true == gb_is_init )
 		{
-			status = par_nvm_write( par_num, true );
+			if ( NULL != p_size )
+			{
+				*p_size = gu32_par_value_size;
+			}
+			else
+			{
+				status = ePAR_ERROR;
+			}
 		}
 		else
 		{
@@ -915,43 +1623,37 @@ par_status_t par_get_range(const par_num_t par_num, par_range_t *const p_range)
 		return status;
 	}
 
+#endif // 1 == PAR_CFG_SNAPSHOT_EN
+
+#if ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+
 	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Store single parameter value to NVM by its ID value
-	*
-	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
-	* 			settings must be enabled.
-	*
-	* @code
-	* 			// Use case
-	* 			// Store par from ID 10 to 32
-	* 			uint8_t par_id;
-	*
-	* 			for ( par_id = 10; par_id < 32; par_id++ )
-	* 			{
-	* 			 	status |= par_save_by_id( par_id )
-	* 			}
+	*		Get current parameter change sequence number
 	*
-	* @endcode
+	* @note		Sequence number is incremented at each actual change of any
+	* 			parameter value.
 	*
-	* @param[in]	par_id	- Parameter ID number
-	* @return		status 	- Status of operation
+	* @param[out]	p_seq	- Pointer to change sequence number
+	* @return		status	- Status of operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_save_by_id(const uint16_t par_id)
+	par_status_t par_get_change_seq(uint32_t * const p_seq)
 	{
-		par_status_t 	status 	= ePAR_OK;
-		par_num_t		par_num	= 0;
+		par_status_t status = ePAR_OK;
 
 		PAR_ASSERT( true == gb_is_init );
+		PAR_ASSERT( NULL != p_seq );
 
 		if ( true == gb_is_init )
 		{
-			status = par_get_num_by_id( par_id, &par_num );
-
-			if ( ePAR_OK == status )
+			if ( NULL != p_seq )
 			{
-				status = par_save( par_num );
+				*p_seq = gp_par_seq->change_seq;
+			}
+			else
+			{
+				status = ePAR_ERROR;
 			}
 		}
 		else
@@ -964,223 +1666,155 @@ par_status_t par_get_range(const par_num_t par_num, par_range_t *const p_range)
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Clean all stored parameters inside NVM
+	*		Get parameters changed since given change sequence number
 	*
-	* @note		This function shall be locked as it will erase complete parameter
-	* 			region of NVM space. Shall be used only during
+	* @brief	Reports parameters whose last change happened after "seq",
+	* 			ordered by time of change. Sequence number to be used for next
+	* 			call is returned thru "p_seq". In case more than "max" parameters
+	* 			changed, oldest changes are reported first and following ones
+	* 			are reported at next call.
 	*
-	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
-	* 			settings must be enabled.
+	* @code
+	* 			static uint32_t seq = 0;
+	* 			par_num_t 		par_num[16];
+	* 			uint32_t 		num;
 	*
-	* @return		status 	- Status of operation
+	* 			par_get_changes_since( seq, par_num, 16, &num, &seq );
+	* @endcode
+	*
+	* @param[in]	seq			- Last sequence number already seen by caller
+	* @param[out]	p_par_num	- Pointer to changed parameter numbers (enumerations)
+	* @param[in]	max			- Size of p_par_num buffer
+	* @param[out]	p_num		- Pointer to number of reported parameters
+	* @param[out]	p_seq		- Pointer to sequence number for next call
+	* @return		status		- Status of operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_save_clean(void)
+	par_status_t par_get_changes_since(const uint32_t seq, par_num_t * const p_par_num, const uint32_t max, uint32_t * const p_num, uint32_t * const p_seq)
 	{
-		par_status_t status = ePAR_OK;
+		par_status_t 	status 	= ePAR_OK;
+		uint32_t		num		= 0UL;
+		uint32_t		next	= seq;
+		uint32_t		par_seq	= 0UL;
+		uint32_t		i		= 0UL;
 
 		PAR_ASSERT( true == gb_is_init );
+		PAR_ASSERT(( NULL != p_par_num ) && ( max > 0UL ));
+		PAR_ASSERT(( NULL != p_num ) && ( NULL != p_seq ));
 
-		if ( true == gb_is_init )
+		if ( true != gb_is_init )
 		{
-			status = par_nvm_reset_all();
+			status = ePAR_ERROR_INIT;
 		}
-		else
+		else if (	( NULL == p_par_num )
+				||	( 0UL == max )
+				||	( NULL == p_num )
+				||	( NULL == p_seq ))
 		{
-			status = ePAR_ERROR_INIT;
+			status = ePAR_ERROR;
 		}
+		else
+		{
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex_rd())
+				{
+			#endif
+					for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+					{
+						par_seq = gp_par_seq->change_seq_par[par_num];
+
+						// Not changed since "seq"
+						if ( 0 >= (int32_t)( par_seq - seq ))
+						{
+							continue;
+						}
+
+						// Buffer full and change is newer than all reported
+						if (( num == max ) && ( 0 < (int32_t)( par_seq - gp_par_seq->change_seq_par[ p_par_num[ num - 1UL ]] )))
+						{
+							continue;
+						}
+
+						// Drop newest to make space
+						if ( num == max )
+						{
+							num--;
+						}
+
+						// Insert ordered by time of change
+						for ( i = num; ( i > 0UL ) && ( 0 < (int32_t)( gp_par_seq->change_seq_par[ p_par_num[ i - 1UL ]] - par_seq )); i-- )
+						{
+							p_par_num[i] = p_par_num[ i - 1UL ];
+						}
+
+						p_par_num[i] = (par_num_t) par_num;
+						num++;
+					}
 
-		return status;
-	}
-
-#endif
+					// All changes reported
+					if ( num < max )
+					{
+						next = gp_par_seq->change_seq;
+					}
 
-#if ( PAR_CFG_DEBUG_EN )
+					// Continue after last reported change
+					else
+					{
+						next = gp_par_seq->change_seq_par[ p_par_num[ num - 1UL ]];
+					}
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Get status string description
-	*
-	* @param[in]	status	- Parameter status
-	* @return		str		- Parameter status description
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	const char * par_get_status_str(const par_status_t status)
-	{
-		uint8_t i = 0;
-		const char * str = "N/A";
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_release_mutex_rd();
+				}
 
-		if ( ePAR_OK == status  )
-		{
-			str = (const char*) gs_status[0];
-		}
-		else
-		{
-			for ( i = 0; i < 16; i++ )
-			{
-				if ( status & ( 1<<i ))
+				// Mutex not acquire
+				else
 				{
-					str =  (const char*) gs_status[i+1];
-					break;
+					status = ePAR_ERROR;
 				}
-			}
+			#endif
+
+			*p_num = num;
+			*p_seq = next;
 		}
 
-		return str;
+		return status;
 	}
-#endif
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-* @} <!-- END GROUP -->
-*/
-////////////////////////////////////////////////////////////////////////////////
+#endif // 1 == PAR_CFG_CHANGE_SEQ_EN
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*@addtogroup KERNEL_FUNCTIONS
-* @{ <!-- BEGIN GROUP -->
+*		Get parameter ID
 *
-* 	Kernel functions of device parameters
+* @param[in]	par_num	- Parameter number (enumeration)
+* @param[out]	p_id 	- Pointer to parameter ID
+* @return		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Allocate space for live parameter values
-*
-* @param[in]	pp_ram_space	- Pointer to pointer allocated space
-* @return		status			- Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_allocate_ram_space(uint8_t ** pp_ram_space)
-{
-	par_status_t 	status 		= ePAR_OK;
-	uint32_t		ram_size	= 0UL;
-
-	// Calculate total size of RAM
-	ram_size = par_calc_ram_usage();
-
-	// Allocate space in RAM
-	*pp_ram_space = malloc( ram_size );
-	PAR_ASSERT( NULL != *pp_ram_space );
-
-	return status;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Calculate total size for parameter live values
-*
-* @note 	This function may not be compatible with other microcontroller
-* 			architectures as it is based on STM32 with its data alignment policy!
-*
-* @return		total_size - Size of all parameters in bytes
-*/
-////////////////////////////////////////////////////////////////////////////////
-static uint32_t par_calc_ram_usage(void)
-{
-	par_cfg_t 	par_cfg 		= { 0 };
-	uint32_t 	par_num			= 0UL;
-	uint32_t	total_size		= 0UL;
-	uint8_t		par_type_size	= 0;
-
-	// For every parameter
-	for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
-	{
-		// Get parameter configs
-		par_get_config( par_num, &par_cfg );
-
-        // Align addresses
-        if	(	( par_cfg.type == ePAR_TYPE_U16 )
-        	|| 	( par_cfg.type == ePAR_TYPE_I16 ))
-        {
-        	// 2 bytes alignment
-            while(( total_size % 2 ) != 0 )
-            {
-            	total_size++;
-            }
-        }
-
-        else if (	( par_cfg.type == ePAR_TYPE_U32 )
-        		|| 	( par_cfg.type == ePAR_TYPE_I32 )
-				|| 	( par_cfg.type == ePAR_TYPE_F32 ))
-        {
-        	// 4 bytes alignment
-            while(( total_size % 4 ) != 0 )
-            {
-            	total_size++;
-            }
-        }
-
-        else
-        {
-        	// No actions...
-        }
-
-        // Store par RAM address offset
-        gu32_par_addr_offset[par_num] = total_size;
-
-		// Get size of data type
-		par_get_type_size( par_cfg.type, &par_type_size );
-
-        // Accumulate total RAM space
-        total_size += par_type_size;
-	}
-
-	return total_size;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Check that parameter table is correctly defined
-*
-* @param[in]	p_par_cfg	- Pointer to parameters table
-* @return		status		- Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static par_status_t	par_check_table_validy(const par_cfg_t * const p_par_cfg)
+par_status_t par_get_id(const par_num_t par_num, uint16_t * const p_id)
 {
 	par_status_t status = ePAR_OK;
 
-	// For each parameter
-	for ( uint32_t i = 0; i < ePAR_NUM_OF; i++ )
+	PAR_ASSERT( true == gb_is_init );
+	PAR_ASSERT( par_num < ePAR_NUM_OF );
+	PAR_ASSERT( NULL != p_id );
+
+	if ( true == gb_is_init )
 	{
-		// Compare parameters IDs
-		for ( uint32_t j = 0; j < ePAR_NUM_OF; j++ )
+		if ( 	( par_num < ePAR_NUM_OF )
+			&&	( NULL != p_id  ))
 		{
-			if ( i != j )
-			{
-				// Check for two identical IDs
-				if ( p_par_cfg[i].id == p_par_cfg[j].id )
-				{
-					status = ePAR_ERROR;
-					PAR_DBG_PRINT( "Parameter table error: Duplicate ID!" );
-					PAR_ASSERT( 0 );
-					break;
-				}
-			}
+			*p_id = PAR_CFG_COLD( par_num ).id;
 		}
-
-		if ( ePAR_OK != status )
+		else
 		{
-			break;
+			status = ePAR_ERROR;
 		}
-
-		/**
-		 * 	Check for correct MIN, MAX and DEF value definitions
-		 *
-		 *	1. Check that MAX is larger than MIN
-		 *	2. Check that DEF is equal or less than MAX
-		 *	3. Check that DEF is equal or more than MIN
-		 */
-		PAR_ASSERT(( ePAR_TYPE_U8 == p_par_cfg[i].type ) 	? ((( p_par_cfg[i].min.u8 < p_par_cfg[i].max.u8 ) && ( p_par_cfg[i].def.u8 <= p_par_cfg[i].max.u8 )) && (  p_par_cfg[i].min.u8 <= p_par_cfg[i].def.u8 )) : ( 1 ));
-		PAR_ASSERT(( ePAR_TYPE_I8 == p_par_cfg[i].type ) 	? ((( p_par_cfg[i].min.i8 < p_par_cfg[i].max.i8 ) && ( p_par_cfg[i].def.i8 <= p_par_cfg[i].max.i8 )) && (  p_par_cfg[i].min.i8 <= p_par_cfg[i].def.i8 )) : ( 1 ));
-		PAR_ASSERT(( ePAR_TYPE_U16 == p_par_cfg[i].type ) 	? ((( p_par_cfg[i].min.u16 < p_par_cfg[i].max.u16 ) && ( p_par_cfg[i].def.u16 <= p_par_cfg[i].max.u16 )) && (  p_par_cfg[i].min.u16 <= p_par_cfg[i].def.u16 )) : ( 1 ));
-		PAR_ASSERT(( ePAR_TYPE_I16 == p_par_cfg[i].type ) 	? ((( p_par_cfg[i].min.i16 < p_par_cfg[i].max.i16 ) && ( p_par_cfg[i].def.i16 <= p_par_cfg[i].max.i16 )) && (  p_par_cfg[i].min.i16 <= p_par_cfg[i].def.i16 )) : ( 1 ));
-		PAR_ASSERT(( ePAR_TYPE_U32 == p_par_cfg[i].type ) 	? ((( p_par_cfg[i].min.u32 < p_par_cfg[i].max.u32 ) && ( p_par_cfg[i].def.u32 <= p_par_cfg[i].max.u32 )) && (  p_par_cfg[i].min.u32 <= p_par_cfg[i].def.u32 )) : ( 1 ));
-		PAR_ASSERT(( ePAR_TYPE_I32 == p_par_cfg[i].type ) 	? ((( p_par_cfg[i].min.i32 < p_par_cfg[i].max.i32 ) && ( p_par_cfg[i].def.i32 <= p_par_cfg[i].max.i32 )) && (  p_par_cfg[i].min.i32 <= p_par_cfg[i].def.i32 )) : ( 1 ));
-		PAR_ASSERT(( ePAR_TYPE_F32 == p_par_cfg[i].type ) 	? ((( p_par_cfg[i].min.f32 < p_par_cfg[i].max.f32 ) && ( p_par_cfg[i].def.f32 <= p_par_cfg[i].max.f32 )) && (  p_par_cfg[i].min.f32 <= p_par_cfg[i].def.f32 )) : ( 1 ));
+	}
+	else
+	{
+		status = ePAR_ERROR_INIT;
 	}
 
 	return status;
@@ -1188,63 +1822,106 @@ static par_status_t	par_check_table_validy(const par_cfg_t * const p_par_cfg)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Set unsigned 8-bit parameter
+*		Get parameter number (enumeration) by ID
 *
-* @param[in]	par_num	- Parameter number (enumeration)
-* @param[in]	u8_val	- Value of parameter
-* @return		status	- Status of operation
+* @param[in]	id 			- Parameter ID
+* @param[out]	p_par_num	- Pointer to parameter enumeration number
+* @return		status		- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_set_u8(const par_num_t par_num, const uint8_t u8_val)
+par_status_t par_get_num_by_id(const uint16_t id, par_num_t * const p_par_num)
 {
 	par_status_t status = ePAR_OK;
 
-	if ( ePAR_OK == status )
+	#if ( 1 == PAR_CFG_STATS_EN )
+		g_par_stats.id_lookup_cnt++;
+	#endif
+
+	PAR_ASSERT( true == gb_is_init );
+	PAR_ASSERT( NULL != p_par_num );
+
+	if ( true == gb_is_init )
 	{
-		if ( u8_val > ( gp_par_table[ par_num ].max.u8 ))
-		{
-			*(uint8_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].max.u8;
-		}
-		else if ( u8_val < ( gp_par_table[ par_num ].min.u8 ))
+		if ( NULL != p_par_num )
 		{
-			*(uint8_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].min.u8;
+			// Does parameter with requested ID even exist
+			status = par_find_id_lut( id, p_par_num );
 		}
 		else
 		{
-			*(uint8_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = (uint8_t) ( u8_val );
+			status = ePAR_ERROR;
 		}
 	}
+	else
+	{
+		status = ePAR_ERROR_INIT;
+	}
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Set signed 8-bit parameter
+*		Get parameter configurations
 *
-* @param[in]	par_num	- Parameter number (enumeration)
-* @param[in]	i8_val	- Value of parameter
-* @return		status	- Status of operation
+* @param[in]	par_num		- Parameter number (enumeration)
+* @param[out]	p_par_cfg	- Pointer to parameter configurations
+* @return		status 		- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_set_i8(const par_num_t par_num, const int8_t i8_val)
+par_status_t par_get_config(const par_num_t par_num, par_cfg_t * const p_par_cfg)
 {
 	par_status_t status = ePAR_OK;
 
-	if ( ePAR_OK == status )
+	#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+		const par_cfg_hot_t * 	p_cfg_hot	= par_cfg_get_table_hot();
+		const par_type_t * 		p_cfg_def	= par_cfg_get_table_def();
+		const par_cfg_cold_t * 	p_cfg_cold	= par_cfg_get_table_cold();
+		const bool				is_table	= (( NULL != p_cfg_hot ) && ( NULL != p_cfg_def ) && ( NULL != p_cfg_cold ));
+	#else
+		const par_cfg_t * 		p_cfg_table	= par_cfg_get_table();
+		const bool				is_table	= ( NULL != p_cfg_table );
+	#endif
+
+	PAR_ASSERT( true == is_table );
+	PAR_ASSERT( NULL != p_par_cfg );
+	PAR_ASSERT( par_num < ePAR_NUM_OF );
+
+	if ( 	( NULL != p_par_cfg )
+		&& 	( true == is_table )
+		&&	( par_num < ePAR_NUM_OF ))
 	{
-		if ( i8_val > ( gp_par_table[ par_num ].max.i8 ))
-		{
-			*(int8_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].max.i8;
-		}
-		else if ( i8_val < ( gp_par_table[ par_num ].min.i8 ))
-		{
-			*(int8_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].min.i8;
-		}
-		else
-		{
-			*(int8_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = (int8_t) ( i8_val );
-		}
+		// Assemble configuration from split tables
+		#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+			p_par_cfg->name 		= p_cfg_cold[ par_num ].name;
+			p_par_cfg->min 			= p_cfg_hot[ par_num ].min;
+			p_par_cfg->max 			= p_cfg_hot[ par_num ].max;
+			p_par_cfg->def 			= p_cfg_def[ par_num ];
+			p_par_cfg->unit 		= p_cfg_cold[ par_num ].unit;
+			p_par_cfg->desc 		= p_cfg_cold[ par_num ].desc;
+			p_par_cfg->id 			= p_cfg_cold[ par_num ].id;
+			p_par_cfg->type 		= p_cfg_hot[ par_num ].type;
+			p_par_cfg->access 		= p_cfg_cold[ par_num ].access;
+			p_par_cfg->persistant 	= p_cfg_cold[ par_num ].persistant;
+
+			#if ( 1 == PAR_CFG_ARRAY_EN )
+				p_par_cfg->len 		= p_cfg_hot[ par_num ].len;
+			#endif
+
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				p_par_cfg->critical = p_cfg_cold[ par_num ].critical;
+			#endif
+
+			#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+				p_par_cfg->policy 	= p_cfg_cold[ par_num ].policy;
+			#endif
+		#else
+			*p_par_cfg = p_cfg_table[ par_num ];
+		#endif
+	}
+	else
+	{
+		status = ePAR_ERROR;
 	}
 
 	return status;
@@ -1252,31 +1929,28 @@ static par_status_t par_set_i8(const par_num_t par_num, const int8_t i8_val)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Set unsigned 16-bit parameter
+*		Get parameter type size
 *
-* @param[in]	par_num	- Parameter number (enumeration)
-* @param[in]	u16_val	- Value of parameter
-* @return		status	- Status of operation
+* @param[in]	type		- Data type of parameter
+* @param[out]	p_size		- Pointer to parameter data type size
+* @return		status 		- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_set_u16(const par_num_t par_num, const uint16_t u16_val)
+par_status_t par_get_type_size(const par_type_list_t type, uint8_t * const p_size)
 {
 	par_status_t status = ePAR_OK;
 
-	if ( ePAR_OK == status )
+	PAR_ASSERT( type < ePAR_TYPE_NUM_OF );
+	PAR_ASSERT( NULL != p_size );
+
+	if ( 	( type < ePAR_TYPE_NUM_OF )
+		&&	( NULL != p_size ))
 	{
-		if ( u16_val > ( gp_par_table[ par_num ].max.u16 ))
-		{
-			*(uint16_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].max.u16;
-		}
-		else if ( u16_val < ( gp_par_table[ par_num ].min.u16 ))
-		{
-			*(uint16_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].min.u16;
-		}
-		else
-		{
-			*(uint16_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = (uint16_t) ( u16_val );
-		}
+		*p_size = g_par_type_desc[type].size;
+	}
+	else
+	{
+		status = ePAR_ERROR;
 	}
 
 	return status;
@@ -1284,31 +1958,30 @@ static par_status_t par_set_u16(const par_num_t par_num, const uint16_t u16_val)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Set signed 16-bit parameter
+*		Get parameter type
 *
 * @param[in]	par_num	- Parameter number (enumeration)
-* @param[in]	i16_val	- Value of parameter
+* @param[out]	p_type 	- Pointer to parameter type
 * @return		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_set_i16(const par_num_t par_num, const int16_t i16_val)
+par_status_t par_get_type(const par_num_t par_num, par_type_list_t *const p_type)
 {
 	par_status_t status = ePAR_OK;
 
-	if ( ePAR_OK == status )
+	PAR_ASSERT( true == gb_is_init );
+	PAR_ASSERT( NULL != p_type );
+    PAR_ASSERT( ePAR_NUM_OF > par_num );
+
+	if ( 	( true == gb_is_init )
+		&&	( NULL != p_type )
+        &&  ( ePAR_NUM_OF > par_num ))
 	{
-		if ( i16_val > ( gp_par_table[ par_num ].max.i16 ))
-		{
-			*(int16_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].max.i16;
-		}
-		else if ( i16_val < ( gp_par_table[ par_num ].min.i16 ))
-		{
-			*(int16_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].min.i16;
-		}
-		else
-		{
-			*(int16_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = (int16_t) ( i16_val );
-		}
+        *p_type = PAR_CFG_HOT( par_num ).type;
+	}
+	else
+	{
+		status = ePAR_ERROR;
 	}
 
 	return status;
@@ -1316,31 +1989,34 @@ static par_status_t par_set_i16(const par_num_t par_num, const int16_t i16_val)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Set unsigned 32-bit parameter
+*		Get number of parameter array elements
+*
+* @note		Single value parameter has one element. Size of value
+* 			exchanged with "par_set()" and "par_get()" is number of
+* 			elements times type size.
 *
 * @param[in]	par_num	- Parameter number (enumeration)
-* @param[in]	u32_val	- Value of parameter
+* @param[out]	p_len 	- Pointer to number of elements
 * @return		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_set_u32(const par_num_t par_num, const uint32_t u32_val)
+par_status_t par_get_len(const par_num_t par_num, uint16_t *const p_len)
 {
 	par_status_t status = ePAR_OK;
 
-	if ( ePAR_OK == status )
+	PAR_ASSERT( true == gb_is_init );
+	PAR_ASSERT( NULL != p_len );
+    PAR_ASSERT( ePAR_NUM_OF > par_num );
+
+	if ( 	( true == gb_is_init )
+		&&	( NULL != p_len )
+        &&  ( ePAR_NUM_OF > par_num ))
 	{
-		if ( u32_val > ( gp_par_table[ par_num ].max.u32 ))
-		{
-			*(uint32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].max.u32;
-		}
-		else if ( u32_val < ( gp_par_table[ par_num ].min.u32 ))
-		{
-			*(uint32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].min.u32;
-		}
-		else
-		{
-			*(uint32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = (uint32_t) ( u32_val );
-		}
+        *p_len = par_get_elem_num( par_num );
+	}
+	else
+	{
+		status = ePAR_ERROR;
 	}
 
 	return status;
@@ -1348,31 +2024,31 @@ static par_status_t par_set_u32(const par_num_t par_num, const uint32_t u32_val)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Set signed 32-bit parameter
+*		Get parameter value range
 *
 * @param[in]	par_num	- Parameter number (enumeration)
-* @param[in]	i32_val	- Value of parameter
+* @param[out]	p_type 	- Pointer to value range
 * @return		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_set_i32(const par_num_t par_num, const int32_t i32_val)
+par_status_t par_get_range(const par_num_t par_num, par_range_t *const p_range)
 {
 	par_status_t status = ePAR_OK;
 
-	if ( ePAR_OK == status )
+	PAR_ASSERT( true == gb_is_init );
+	PAR_ASSERT( NULL != p_range );
+    PAR_ASSERT( ePAR_NUM_OF > par_num );
+
+	if ( 	( true == gb_is_init )
+		&&	( NULL != p_range )
+        &&  ( ePAR_NUM_OF > par_num ))
 	{
-		if ( i32_val > ( gp_par_table[ par_num ].max.i32 ))
-		{
-			*(int32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].max.i32;
-		}
-		else if ( i32_val < ( gp_par_table[ par_num ].min.i32 ))
-		{
-			*(int32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].min.i32;
-		}
-		else
-		{
-			*(int32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = (int32_t) ( i32_val );
-		}
+        p_range->min = PAR_CFG_HOT( par_num ).min;
+        p_range->max = PAR_CFG_HOT( par_num ).max;
+	}
+	else
+	{
+		status = ePAR_ERROR;
 	}
 
 	return status;
@@ -1380,126 +2056,3014 @@ static par_status_t par_set_i32(const par_num_t par_num, const int32_t i32_val)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Set floating value parameter
+*		Get memory usage of module
 *
-* @param[in]	par_num	- Parameter number (enumeration)
-* @param[in]	f32_val	- Value of parameter
+* @note		Sizes are summed from module variables, thus alignment padding
+* 			between them added by linker is not included.
+*
+* @param[out]	p_usage	- Pointer to memory usage
 * @return		status	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static par_status_t par_set_f32(const par_num_t par_num, const float32_t f32_val)
+par_status_t par_get_mem_usage(par_mem_usage_t * const p_usage)
 {
 	par_status_t status = ePAR_OK;
 
-	if ( ePAR_OK == status )
+	PAR_ASSERT( true == gb_is_init );
+	PAR_ASSERT( NULL != p_usage );
+
+	if 	(	( true == gb_is_init )
+		&&	( NULL != p_usage ))
 	{
-		if ( f32_val > ( gp_par_table[ par_num ].max.f32 ))
-		{
-			*(float32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].max.f32;
-		}
-		else if ( f32_val < ( gp_par_table[ par_num ].min.f32 ))
-		{
-			*(float32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = gp_par_table[ par_num ].min.f32;
-		}
-		else
-		{
-			*(float32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ] = (float32_t) ( f32_val );
-		}
-	}
+		uint32_t ram 	= sizeof( gb_is_init );
+		uint32_t flash 	= sizeof( g_par_type_desc );
+
+		// Parameter table
+		#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+			ram += ( sizeof( gp_par_table_hot ) + sizeof( gp_par_table_def ) + sizeof( gp_par_table_cold ));
+		#else
+			ram += sizeof( gp_par_table );
+		#endif
+
+		// Live values and address offsets
+		#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+			p_usage->ram_value 	= sizeof( par_layout_t );
+			p_usage->ram_index 	= 0UL;
+			flash += ( sizeof( gpu8_par_value ) + sizeof( g_par_addr_offset ) + sizeof( g_par_def_image ) + sizeof( gpu8_par_def_image ));
+
+			#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+				flash += sizeof( gu32_par_value_size );
+			#endif
+		#else
+			p_usage->ram_value 	= gu32_par_value_size;
+			p_usage->ram_index 	= sizeof( g_par_addr_offset );
+			ram += ( sizeof( gpu8_par_value ) + sizeof( gu32_par_value_size ));
+		#endif
+
+		// Sequence counters
+		#if ( 1 == PAR_CFG_SHARED_EN )
+			ram += ( sizeof( par_shared_t ) - sizeof( par_layout_t ));
+		#endif
+		#if ( 1 == PAR_CFG_SNAPSHOT_EN ) || ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+			#if ( 0 == PAR_CFG_SHARED_EN )
+				ram += sizeof( g_par_seq );
+			#endif
+			flash += sizeof( gp_par_seq );
+		#endif
 
-	return status;
-}
+		// ID look-up table
+		#if ( 1 == PAR_CFG_ID_LUT_DIRECT_EN )
+			p_usage->ram_index += sizeof( gu16_par_id_lut );
+		#else
+			p_usage->ram_index += sizeof( g_par_id_lut );
+		#endif
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Get unsigned 8-bit parameter
-*
-* @param[in]	par_num	- Parameter number (enumeration)
-* @return		value   - Value of parameter
-*/
-////////////////////////////////////////////////////////////////////////////////
-static uint8_t par_get_u8(const par_num_t par_num)
-{
-    return *(uint8_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ];
-}
+		#if ( 1 == PAR_CFG_NVM_EN )
+			ram += sizeof( gu32_par_dirty );
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Get signed 8-bit parameter
-*
-* @param[in]	par_num	- Parameter number (enumeration)
-* @return		value   - Value of parameter
-*/
-////////////////////////////////////////////////////////////////////////////////
-static int8_t par_get_i8(const par_num_t par_num)
-{
-    return *(int8_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ];
-}
+			#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+				ram += ( sizeof( gu32_par_wb_pending ) + sizeof( gu32_par_wb_first_ms ) + sizeof( gu32_par_wb_last_ms ) + sizeof( gb_par_wb_pending ));
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Get unsigned 16-bit parameter
-*
-* @param[in]	par_num	- Parameter number (enumeration)
-* @return		value   - Value of parameter
-*/
-////////////////////////////////////////////////////////////////////////////////
-static uint16_t par_get_u16(const par_num_t par_num)
-{
-    return *(uint16_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ];
-}
+				#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+					ram += ( sizeof( g_par_wb_stored ) + sizeof( gu32_par_wb_stored_ms ) + sizeof( gu32_par_wb_stored_valid ));
+				#endif
+			#endif
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Get signed 16-bit parameter
-*
-* @param[in]	par_num	- Parameter number (enumeration)
-* @return		value   - Value of parameter
-*/
-////////////////////////////////////////////////////////////////////////////////
-static int16_t par_get_i16(const par_num_t par_num)
-{
-    return *(int16_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ];
-}
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				ram += sizeof( gu32_par_loaded );
+			#endif
+		#endif
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Get unsigned 32-bit parameter
-*
-* @param[in]	par_num	- Parameter number (enumeration)
-* @return		value   - Value of parameter
-*/
-////////////////////////////////////////////////////////////////////////////////
-static uint32_t par_get_u32(const par_num_t par_num)
-{
-    return *(uint32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ];
-}
+		#if ( 1 == PAR_CFG_STATS_EN )
+			ram += sizeof( g_par_stats );
+		#endif
+
+		#if ( 1 == PAR_CFG_PROFILE_EN )
+			ram += sizeof( g_par_profile );
+		#endif
+
+		#if ( 1 == PAR_CFG_NOTIFY_EN )
+			ram += ( sizeof( g_par_sub ) + sizeof( gu32_par_notify_pending ) + sizeof( gb_par_notify_pending ));
+		#endif
+
+		#if ( PAR_CFG_DEBUG_EN )
+			ram += sizeof( gs_status );
+		#endif
+
+		p_usage->ram_total 		= ( p_usage->ram_value + p_usage->ram_index + ram );
+		p_usage->flash_table 	= par_cfg_get_table_size();
+		p_usage->flash_total 	= ( p_usage->flash_table + flash );
+
+		// NVM module adds its own usage
+		#if ( 1 == PAR_CFG_NVM_EN )
+			par_nvm_get_mem_usage( p_usage );
+		#endif
+	}
+	else
+	{
+		status = ePAR_ERROR;
+	}
+
+	return status;
+}
+
+#if ( 1 == PAR_CFG_NVM_EN )
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *		Set parameter value and save to NVM if value changed
+    *
+    * @note 	Mandatory to cast input argument to appropriate type. E.g.:
+    *
+    * @code
+    * 			float32_t my_val = 1.234f;
+    * 			par_set( ePAR_MY_VAR, (float32_t*) &my_val );
+    * @endcode
+    *
+    * @note		Input is parameter number (enumeration) defined in par_cfg.h and not
+    * 			parameter ID number!
+    *
+    * @param[in]	par_num	- Parameter number (enumeration)
+    * @param[in]	p_val	- Pointer to value
+    * @return		status 	- Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    par_status_t par_set_n_save(const par_num_t par_num, const void * p_val)
+    {
+    	par_status_t status = ePAR_OK;
+
+    	// Is init
+    	PAR_ASSERT( true == gb_is_init );
+
+    	// Check input
+    	PAR_ASSERT( par_num < ePAR_NUM_OF );
+
+        status |= par_set(par_num, p_val);
+
+		#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+
+			// Stored later by "par_hndl()" or "par_flush()"
+			if ( ePAR_OK == status )
+			{
+				par_wb_schedule( par_num );
+			}
+
+		#else
+
+			// Store only if value differs from NVM
+			if (( ePAR_OK == status ) && ( true == par_dirty_take( par_num )))
+			{
+				status |= par_nvm_write( par_num, true );
+
+				if ( ePAR_OK != status )
+				{
+					par_dirty_restore( par_num );
+				}
+			}
+
+			// Values loaded while storing
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				par_load_notify();
+			#endif
+
+		#endif
+
+    	return status;
+    }
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Store all parameters value to NVM
+	*
+	* @note		In case of NVM error parameters changed since last store stay
+	* 			marked as changed and are retried by "par_save_dirty()" or
+	* 			write-back.
+	*
+	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
+	* 			settings must be enabled.
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_save_all(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		PAR_ASSERT( true == gb_is_init );
+
+		if ( true == gb_is_init )
+		{
+			uint32_t dirty[ PAR_DIRTY_WORD_NUM ] = { 0 };
+
+			// Values changed during write stay marked as changed
+			for ( uint32_t word = 0; word < PAR_DIRTY_WORD_NUM; word++ )
+			{
+				dirty[word] = par_dirty_take_word( word );
+			}
+
+			status = par_nvm_write_all();
+
+			// Retry on next store
+			if ( ePAR_OK != status )
+			{
+				for ( uint32_t word = 0; word < PAR_DIRTY_WORD_NUM; word++ )
+				{
+					par_dirty_restore_word( word, dirty[word] );
+				}
+			}
+
+			// Values loaded while storing
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				par_load_notify();
+			#endif
+		}
+		else
+		{
+			status = ePAR_ERROR_INIT;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Store only changed parameters value to NVM
+	*
+	* @brief	Only persistent parameters which value has changed since last
+	* 			store are written to NVM, followed by single NVM sync. Header is
+	* 			left intact as number of stored objects does not change.
+	*
+	* 			Parameter that fails to be written stays marked as changed and
+	* 			will be retried on next call.
+	*
+	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
+	* 			settings must be enabled.
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_save_dirty(void)
+	{
+		par_status_t 	status 		= ePAR_OK;
+		par_status_t 	par_status	= ePAR_OK;
+		uint32_t		dirty		= 0UL;
+		uint32_t		par_num		= 0UL;
+		bool			written		= false;
+
+		PAR_ASSERT( true == gb_is_init );
+
+		if ( true == gb_is_init )
+		{
+			for ( uint32_t word = 0; word < PAR_DIRTY_WORD_NUM; word++ )
+			{
+				dirty = par_dirty_take_word( word );
+
+				for ( uint32_t bit = 0; ( bit < 32U ) && ( 0UL != dirty ); bit++ )
+				{
+					if ( 0UL == ( dirty & ( 1UL << bit )))
+					{
+						continue;
+					}
+
+					dirty &= ~( 1UL << bit );
+					par_num = ( word * 32U ) + bit;
+
+					// Sync will be done later
+					par_status = par_nvm_write( par_num, false );
+
+					if ( ePAR_OK == par_status )
+					{
+						written = true;
+					}
+					else
+					{
+						par_dirty_restore( par_num );
+					}
+
+					status |= par_status;
+				}
+			}
+
+			if ( true == written )
+			{
+				status |= par_nvm_sync();
+			}
+
+			// Values loaded while storing
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				par_load_notify();
+			#endif
+		}
+		else
+		{
+			status = ePAR_ERROR_INIT;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Store single parameter value to NVM
+	*
+	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
+	* 			settings must be enabled.
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_save(const par_num_t par_num)
+	{
+		par_status_t status = ePAR_OK;
+
+		PAR_ASSERT( true == gb_is_init );
+
+		if ( true == gb_is_init )
+		{
+			const bool was_dirty = par_dirty_take( par_num );
+
+			status = par_nvm_write( par_num, true );
+
+			if (( ePAR_OK != status ) && ( true == was_dirty ))
+			{
+				par_dirty_restore( par_num );
+			}
+
+			// Values loaded while storing
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				par_load_notify();
+			#endif
+		}
+		else
+		{
+			status = ePAR_ERROR_INIT;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Store single parameter value to NVM by its ID value
+	*
+	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
+	* 			settings must be enabled.
+	*
+	* @code
+	* 			// Use case
+	* 			// Store par from ID 10 to 32
+	* 			uint8_t par_id;
+	*
+	* 			for ( par_id = 10; par_id < 32; par_id++ )
+	* 			{
+	* 			 	status |= par_save_by_id( par_id )
+	* 			}
+	*
+	* @endcode
+	*
+	* @param[in]	par_id	- Parameter ID number
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_save_by_id(const uint16_t par_id)
+	{
+		par_status_t 	status 	= ePAR_OK;
+		par_num_t		par_num	= 0;
+
+		PAR_ASSERT( true == gb_is_init );
+
+		if ( true == gb_is_init )
+		{
+			status = par_get_num_by_id( par_id, &par_num );
+
+			if ( ePAR_OK == status )
+			{
+				status = par_save( par_num );
+			}
+		}
+		else
+		{
+			status = ePAR_ERROR_INIT;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Clean all stored parameters inside NVM
+	*
+	* @note		This function shall be locked as it will erase complete parameter
+	* 			region of NVM space. Shall be used only during
+	*
+	* @pre		NVM storage must be initialized first and "PAR_CFG_NVM_EN"
+	* 			settings must be enabled.
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_save_clean(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		PAR_ASSERT( true == gb_is_init );
+
+		if ( true == gb_is_init )
+		{
+			par_dirty_clear_all();
+			status = par_nvm_reset_all();
+
+			// Values loaded while storing
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				par_load_notify();
+			#endif
+		}
+		else
+		{
+			status = ePAR_ERROR_INIT;
+		}
+
+		return status;
+	}
+
+	#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Parameters NVM write-back handler
+		*
+		* @brief	Stores parameters scheduled by "par_set_n_save()" once there
+		* 			was no new request for "PAR_CFG_NVM_WRITE_BACK_QUIET_MS" or
+		* 			oldest request waits for "PAR_CFG_NVM_WRITE_BACK_DEADLINE_MS".
+		*
+		* @note		Shall be called periodically from low priority task!
+		*
+		* 			With "PAR_CFG_NVM_POLICY_EN" parameter is stored only
+		* 			when allowed by its persistence policy.
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_hndl(void)
+		{
+			par_status_t 	status 	= ePAR_OK;
+			bool			is_due	= false;
+			uint32_t		now_ms	= 0UL;
+
+			PAR_ASSERT( true == gb_is_init );
+
+			if ( true == gb_is_init )
+			{
+				#if ( 1 == PAR_CFG_MUTEX_EN )
+					if ( ePAR_OK == par_aquire_mutex())
+					{
+				#endif
+						if ( true == gb_par_wb_pending )
+						{
+							now_ms = par_if_get_time_ms();
+
+							if 	(	(( now_ms - gu32_par_wb_last_ms ) >= PAR_CFG_NVM_WRITE_BACK_QUIET_MS )
+								||	(( now_ms - gu32_par_wb_first_ms ) >= PAR_CFG_NVM_WRITE_BACK_DEADLINE_MS ))
+							{
+								is_due = true;
+							}
+						}
+
+				#if ( 1 == PAR_CFG_MUTEX_EN )
+						par_if_release_mutex();
+					}
+
+					// Mutex not acquire
+					else
+					{
+						status = ePAR_ERROR;
+					}
+				#endif
+
+				if ( true == is_due )
+				{
+					status |= par_wb_flush( false );
+				}
+			}
+			else
+			{
+				status = ePAR_ERROR_INIT;
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Store all scheduled parameters to NVM immediately
+		*
+		* @note		Intended for shutdown and brown-out paths. Persistence
+		* 			policy (PAR_CFG_NVM_POLICY_EN) is not applied.
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_flush(void)
+		{
+			par_status_t status = ePAR_OK;
+
+			PAR_ASSERT( true == gb_is_init );
+
+			if ( true == gb_is_init )
+			{
+				status = par_wb_flush( true );
+			}
+			else
+			{
+				status = ePAR_ERROR_INIT;
+			}
+
+			return status;
+		}
+
+	#endif // 1 == PAR_CFG_NVM_WRITE_BACK_EN
+
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Parameters lazy NVM load handler
+		*
+		* @brief	Loads next chunk of stored parameters from NVM. Once all of
+		* 			them are loaded, function has no effect.
+		*
+		* @note		Shall be called periodically from low priority task!
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_load_hndl(void)
+		{
+			par_status_t status = ePAR_OK;
+
+			PAR_ASSERT( true == gb_is_init );
+
+			if ( true == gb_is_init )
+			{
+				status = par_nvm_load_hndl();
+
+				par_load_notify();
+			}
+			else
+			{
+				status = ePAR_ERROR_INIT;
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Check if parameter value is loaded from NVM
+		*
+		* @note		Non-persistent parameters and parameters written since init
+		* 			are always reported as loaded.
+		*
+		* @param[in]	par_num		- Parameter number (enumeration)
+		* @param[out]	p_is_loaded	- Pointer to loaded flag
+		* @return		status 		- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_is_loaded(const par_num_t par_num, bool * const p_is_loaded)
+		{
+			par_status_t status = ePAR_OK;
+
+			PAR_ASSERT( true == gb_is_init );
+			PAR_ASSERT( par_num < ePAR_NUM_OF );
+			PAR_ASSERT( NULL != p_is_loaded );
+
+			if ( true == gb_is_init )
+			{
+				if (( par_num < ePAR_NUM_OF ) && ( NULL != p_is_loaded ))
+				{
+					*p_is_loaded = ( 0UL != ( gu32_par_loaded[ par_num / 32U ] & ( 1UL << ( par_num % 32U ))));
+				}
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			}
+			else
+			{
+				status = ePAR_ERROR_INIT;
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Set parameter value loaded from NVM
+		*
+		* @note		Used by NVM module. Value is applied only if parameter was
+		* 			not written since init, as newer value shall not be
+		* 			overridden by stored one. Parameter is not marked for
+		* 			storing to NVM.
+		*
+		* 			Value which is not final (object of other size than
+		* 			parameter type) leaves parameter not loaded, thus newer
+		* 			object of the same parameter later in image still wins.
+		*
+		* 			Subscribers are only marked for notification, as NVM
+		* 			mutex is being held by caller. They are called by
+		* 			"par_load_hndl()" or on demand load once NVM is released.
+		*
+		* @param[in]	par_num		- Parameter number (enumeration)
+		* @param[in]	p_val		- Pointer to value
+		* @param[in]	is_final	- Value is final, parameter is marked as loaded
+		* @return		status 		- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_set_loaded(const par_num_t par_num, const void * p_val, const bool is_final)
+		{
+			par_status_t status = ePAR_OK;
+
+			PAR_ASSERT( true == gb_is_init );
+			PAR_ASSERT( par_num < ePAR_NUM_OF );
+
+			if ( true == gb_is_init )
+			{
+				if ( par_num < ePAR_NUM_OF )
+				{
+					#if ( 1 == PAR_CFG_MUTEX_EN )
+						if ( ePAR_OK == par_aquire_mutex())
+						{
+					#endif
+							if ( 0UL == ( gu32_par_loaded[ par_num / 32U ] & ( 1UL << ( par_num % 32U ))))
+							{
+								par_seq_write_begin();
+								status = par_set_value( par_num, p_val, false );
+								par_seq_write_end();
+
+								// Value is in sync with NVM
+								gu32_par_dirty[ par_num / 32U ] &= ~( 1UL << ( par_num % 32U ));
+
+								// Wait for newer object
+								if ( true != is_final )
+								{
+									gu32_par_loaded[ par_num / 32U ] &= ~( 1UL << ( par_num % 32U ));
+								}
+							}
+
+					#if ( 1 == PAR_CFG_MUTEX_EN )
+							par_if_release_mutex();
+						}
+
+						// Mutex not acquire
+						else
+						{
+							status = ePAR_ERROR;
+						}
+					#endif
+				}
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			}
+			else
+			{
+				status = ePAR_ERROR_INIT;
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Mark all parameters as loaded from NVM
+		*
+		* @note		Used by NVM module once all stored parameters are loaded
+		* 			or loading is aborted.
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_set_loaded_all(void)
+		{
+			par_status_t status = ePAR_OK;
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					memset( gu32_par_loaded, 0xFF, sizeof( gu32_par_loaded ));
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			#endif
+
+			return status;
+		}
+
+	#endif // 1 == PAR_CFG_NVM_LAZY_EN
+
+	#if ( 1 == PAR_CFG_NVM_JOURNAL_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Mark all parameters as stored to NVM
+		*
+		* @note		Used by NVM module before journal is compacted, as live
+		* 			values of all persistent parameters are stored then.
+		* 			Value changed during compaction is marked again.
+		*
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		void par_set_stored_all(void)
+		{
+			par_dirty_clear_all();
+		}
+
+	#endif // 1 == PAR_CFG_NVM_JOURNAL_EN
+
+#endif
+
+#if ( 1 == PAR_CFG_PROFILE_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Capture live values into parameter profile
+	*
+	* @note		Only parameters with value different from default are
+	* 			captured. Array parameters are not captured.
+	*
+	* @param[in]	profile	- Profile number
+	* @return		status 	- Status of operation, ePAR_ERROR if too many parameters differ
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_profile_capture(const uint8_t profile)
+	{
+		par_status_t 	status 		= ePAR_OK;
+		par_profile_t *	p_profile	= NULL;
+		uint8_t			size		= 0U;
+
+		PAR_ASSERT( true == gb_is_init );
+		PAR_ASSERT( profile < PAR_CFG_PROFILE_NUM );
+
+		if ( true != gb_is_init )
+		{
+			status = ePAR_ERROR_INIT;
+		}
+		else if ( profile >= PAR_CFG_PROFILE_NUM )
+		{
+			status = ePAR_ERROR;
+		}
+		else
+		{
+			p_profile = &g_par_profile[profile];
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					p_profile->num = 0U;
+
+					for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+					{
+						// Array parameters are not part of profile
+						if ( par_get_elem_num( par_num ) > 1U )
+						{
+							continue;
+						}
+
+						(void) par_get_type_size( PAR_CFG_HOT( par_num ).type, &size );
+
+						// Same as default
+						if ( 0 == memcmp( &gpu8_par_value[ g_par_addr_offset[par_num] ], &PAR_CFG_DEF( par_num ), size ))
+						{
+							continue;
+						}
+
+						// Profile full
+						if ( p_profile->num >= PAR_CFG_PROFILE_ENTRY_NUM )
+						{
+							p_profile->num = 0U;
+							status = ePAR_ERROR;
+							PAR_DBG_PRINT( "PAR: Too many parameters for profile!" );
+							break;
+						}
+
+						p_profile->entry[ p_profile->num ].par_num 	= par_num;
+						p_profile->entry[ p_profile->num ].val.u32 	= 0UL;
+						memcpy( &p_profile->entry[ p_profile->num ].val, &gpu8_par_value[ g_par_addr_offset[par_num] ], size );
+						p_profile->num++;
+					}
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			#endif
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Clear parameter profile
+	*
+	* @note		Activation of empty profile sets all parameters to default.
+	*
+	* @param[in]	profile	- Profile number
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_profile_clear(const uint8_t profile)
+	{
+		par_status_t status = ePAR_OK;
+
+		PAR_ASSERT( profile < PAR_CFG_PROFILE_NUM );
+
+		if ( profile < PAR_CFG_PROFILE_NUM )
+		{
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					g_par_profile[profile].num = 0U;
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			#endif
+		}
+		else
+		{
+			status = ePAR_ERROR;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Activate parameter profile
+	*
+	* @brief	All parameters are set to default value overlaid by profile
+	* 			values under single mutex acquisition, so that readers never
+	* 			see mix of two profiles thru snapshot.
+	*
+	* @note		Changed values are not marked for storing to NVM as profile
+	* 			is stored as a unit, see "par_profile_save()".
+	*
+	* 			Array parameters are left unchanged. Profile values are limited
+	* 			to parameter range, as it might change since profile was stored.
+	*
+	* @param[in]	profile	- Profile number
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_profile_activate(const uint8_t profile)
+	{
+				par_status_t 		status 		= ePAR_OK;
+		const	par_profile_t *		p_profile	= NULL;
+		const	par_type_desc_t *	p_desc		= NULL;
+		const	void *				p_val		= NULL;
+				par_type_t			val			= { 0 };
+				uint32_t			entry		= 0UL;
+				uint8_t				size		= 0U;
+
+		PAR_ASSERT( true == gb_is_init );
+		PAR_ASSERT( profile < PAR_CFG_PROFILE_NUM );
+
+		if ( true != gb_is_init )
+		{
+			status = ePAR_ERROR_INIT;
+		}
+		else if ( profile >= PAR_CFG_PROFILE_NUM )
+		{
+			status = ePAR_ERROR;
+		}
+		else
+		{
+			p_profile = &g_par_profile[profile];
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					par_seq_write_begin();
+
+					for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+					{
+						// Array parameters are not part of profile
+						if ( par_get_elem_num( par_num ) > 1U )
+						{
+							continue;
+						}
+
+						par_loaded_mark( par_num );
+
+						// Entries are ordered by parameter number
+						if (( entry < p_profile->num ) && ( par_num == p_profile->entry[entry].par_num ))
+						{
+							val 	= p_profile->entry[entry].val;
+							p_desc 	= &g_par_type_desc[ PAR_CFG_HOT( par_num ).type ];
+							entry++;
+
+							// Range might change since profile was stored to NVM
+							if ( p_desc->pf_cmp( &val, &PAR_CFG_HOT( par_num ).max ) > 0 )
+							{
+								val = PAR_CFG_HOT( par_num ).max;
+							}
+							else if ( p_desc->pf_cmp( &val, &PAR_CFG_HOT( par_num ).min ) < 0 )
+							{
+								val = PAR_CFG_HOT( par_num ).min;
+							}
+							else
+							{
+								// Value within range
+							}
+
+							p_val = &val;
+						}
+						else
+						{
+							p_val = &PAR_CFG_DEF( par_num );
+						}
+
+						(void) par_get_type_size( PAR_CFG_HOT( par_num ).type, &size );
+
+						// Store only if value changes
+						if ( 0 != memcmp( &gpu8_par_value[ g_par_addr_offset[par_num] ], p_val, size ))
+						{
+							par_value_store( &gpu8_par_value[ g_par_addr_offset[par_num] ], p_val, size );
+							par_on_change_notify( par_num );
+						}
+					}
+
+					par_seq_write_end();
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			#endif
+
+			// Notify subscribers (outside of mutex)
+			#if ( 1 == PAR_CFG_NOTIFY_EN ) && ( 0 == PAR_CFG_NOTIFY_DEFER_EN )
+				par_notify_dispatch();
+			#endif
+		}
+
+		return status;
+	}
+
+	#if ( 1 == PAR_CFG_NVM_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Store parameter profile to NVM
+		*
+		* @note		Stored profiles are loaded at init.
+		*
+		* @param[in]	profile	- Profile number
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_profile_save(const uint8_t profile)
+		{
+			par_status_t status = ePAR_OK;
+
+			PAR_ASSERT( true == gb_is_init );
+			PAR_ASSERT( profile < PAR_CFG_PROFILE_NUM );
+
+			if ( true != gb_is_init )
+			{
+				status = ePAR_ERROR_INIT;
+			}
+			else if ( profile >= PAR_CFG_PROFILE_NUM )
+			{
+				status = ePAR_ERROR;
+			}
+			else
+			{
+				status = par_nvm_profile_write( profile, &g_par_profile[profile] );
+			}
+
+			return status;
+		}
+
+	#endif
+
+#endif // 1 == PAR_CFG_PROFILE_EN
+
+#if ( 1 == PAR_CFG_NOTIFY_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Subscribe to parameter change
+	*
+	* @note		Callback is called once clamped live value of parameter actually
+	* 			changes. Callback is never called while mutex is held, therefore
+	* 			it can use complete parameter API.
+	*
+	* 			Subscription to "ePAR_NUM_OF" notifies about change of any
+	* 			parameter.
+	*
+	* @param[in]	par_num	- Parameter number (enumeration) or ePAR_NUM_OF for all
+	* @param[in]	cb		- Callback function
+	* @param[in]	p_ctx	- Subscriber context passed to callback
+	* @return		status 	- Status of operation, ePAR_ERROR if no free subscription
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_subscribe(const par_num_t par_num, const par_notify_cb_t cb, void * const p_ctx)
+	{
+		par_status_t status = ePAR_OK;
+
+		PAR_ASSERT( true == gb_is_init );
+		PAR_ASSERT( par_num <= ePAR_NUM_OF );
+		PAR_ASSERT( NULL != cb );
+
+		if ( true != gb_is_init )
+		{
+			status = ePAR_ERROR_INIT;
+		}
+		else if (	( par_num <= ePAR_NUM_OF )
+				&&	( NULL != cb ))
+		{
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					status = ePAR_ERROR;
+
+					for ( uint32_t i = 0; i < PAR_CFG_NOTIFY_SUB_NUM; i++ )
+					{
+						// Free subscription
+						if ( NULL == g_par_sub[i].cb )
+						{
+							g_par_sub[i].par_num 	= par_num;
+							g_par_sub[i].p_ctx 		= p_ctx;
+							g_par_sub[i].cb 		= cb;
+							status 					= ePAR_OK;
+							break;
+						}
+					}
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			#endif
+
+			PAR_DBG_PRINT( "PAR: Subscribe to par %d status: %s", par_num, par_get_status_str( status ));
+		}
+		else
+		{
+			status = ePAR_ERROR;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Unsubscribe from parameter change
+	*
+	* @param[in]	par_num	- Parameter number (enumeration) or ePAR_NUM_OF for all
+	* @param[in]	cb		- Callback function
+	* @param[in]	p_ctx	- Subscriber context
+	* @return		status 	- Status of operation, ePAR_ERROR if not subscribed
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_unsubscribe(const par_num_t par_num, const par_notify_cb_t cb, void * const p_ctx)
+	{
+		par_status_t status = ePAR_ERROR;
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				for ( uint32_t i = 0; i < PAR_CFG_NOTIFY_SUB_NUM; i++ )
+				{
+					if 	(	( cb == g_par_sub[i].cb )
+						&&	( par_num == g_par_sub[i].par_num )
+						&&	( p_ctx == g_par_sub[i].p_ctx ))
+					{
+						g_par_sub[i].cb = NULL;
+						status = ePAR_OK;
+						break;
+					}
+				}
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Handle pending parameter change notifications
+	*
+	* @note		With "PAR_CFG_NOTIFY_DEFER_EN" shall be called periodically
+	* 			from task context, otherwise notifications are dispatched by
+	* 			setters already.
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_notify_hndl(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		PAR_ASSERT( true == gb_is_init );
+
+		if ( true == gb_is_init )
+		{
+			par_notify_dispatch();
+		}
+		else
+		{
+			status = ePAR_ERROR_INIT;
+		}
+
+		return status;
+	}
+
+#endif // 1 == PAR_CFG_NOTIFY_EN
+
+#if ( 1 == PAR_CFG_STATS_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get runtime statistics
+	*
+	* @param[out]	p_stats	- Pointer to statistics
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_get_stats(par_stats_t * const p_stats)
+	{
+		par_status_t status = ePAR_OK;
+
+		PAR_ASSERT( NULL != p_stats );
+
+		if ( NULL != p_stats )
+		{
+			*p_stats = g_par_stats;
+
+			#if ( 1 == PAR_CFG_NVM_EN )
+				par_nvm_get_stats( &p_stats->nvm );
+			#endif
+		}
+		else
+		{
+			status = ePAR_ERROR;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Clear runtime statistics
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_clear_stats(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		memset( &g_par_stats, 0, sizeof( g_par_stats ));
+
+		#if ( 1 == PAR_CFG_NVM_EN )
+			par_nvm_clear_stats();
+		#endif
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Print runtime statistics
+	*
+	* @note		Printed thru "PAR_DBG_PRINT", thus has no affect if
+	* 			"PAR_CFG_DEBUG_EN" is set to 0.
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	void par_print_stats(void)
+	{
+		par_stats_t stats = { 0 };
+
+		(void) par_get_stats( &stats );
+
+		PAR_DBG_PRINT( "PAR: Stats calls: set %d, get %d, set batch %d, get batch %d, id lookup %d", stats.set_cnt, stats.get_cnt, stats.set_batch_cnt, stats.get_batch_cnt, stats.id_lookup_cnt );
+		PAR_DBG_PRINT( "PAR: Stats clamps: %d, mutex errors: %d", stats.clamp_cnt, stats.mutex_err_cnt );
+
+		#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+			PAR_DBG_PRINT( "PAR: Stats mutex wait: min %d, max %d, avg %d", stats.mutex_wait.min, stats.mutex_wait.max, (uint32_t)(( stats.mutex_wait.cnt > 0UL ) ? ( stats.mutex_wait.sum / stats.mutex_wait.cnt ) : 0ULL ));
+			PAR_DBG_PRINT( "PAR: Stats set latency: min %d, max %d, avg %d", stats.set_lat.min, stats.set_lat.max, (uint32_t)(( stats.set_lat.cnt > 0UL ) ? ( stats.set_lat.sum / stats.set_lat.cnt ) : 0ULL ));
+			PAR_DBG_PRINT( "PAR: Stats get latency: min %d, max %d, avg %d", stats.get_lat.min, stats.get_lat.max, (uint32_t)(( stats.get_lat.cnt > 0UL ) ? ( stats.get_lat.sum / stats.get_lat.cnt ) : 0ULL ));
+		#endif
+
+		#if ( 1 == PAR_CFG_NVM_EN )
+			PAR_DBG_PRINT( "PAR: Stats NVM: read %d (%d bytes), write %d (%d bytes), erase %d, sync %d, CRC errors %d", stats.nvm.rd_cnt, stats.nvm.rd_bytes, stats.nvm.wr_cnt, stats.nvm.wr_bytes, stats.nvm.erase_cnt, stats.nvm.sync_cnt, stats.nvm.crc_err_cnt );
+		#endif
+	}
+
+#endif // 1 == PAR_CFG_STATS_EN
+
+#if ( PAR_CFG_DEBUG_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get status string description
+	*
+	* @param[in]	status	- Parameter status
+	* @return		str		- Parameter status description
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	const char * par_get_status_str(const par_status_t status)
+	{
+		uint8_t i = 0;
+		const char * str = "N/A";
+
+		if ( ePAR_OK == status  )
+		{
+			str = (const char*) gs_status[0];
+		}
+		else
+		{
+			for ( i = 0; i < 16; i++ )
+			{
+				if ( status & ( 1<<i ))
+				{
+					str =  (const char*) gs_status[i+1];
+					break;
+				}
+			}
+		}
+
+		return str;
+	}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup KERNEL_FUNCTIONS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Kernel functions of device parameters
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 0 == PAR_CFG_STATIC_LAYOUT_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Allocate space for live parameter values
+	*
+	* @param[in]	pp_ram_space	- Pointer to pointer allocated space
+	* @return		status			- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static par_status_t par_allocate_ram_space(uint8_t ** pp_ram_space)
+	{
+		par_status_t 	status 		= ePAR_OK;
+		uint32_t		ram_size	= 0UL;
+
+		// Calculate total size of RAM
+		ram_size = par_calc_ram_usage();
+		gu32_par_value_size = ram_size;
+
+		// Address offsets shall fit into "par_addr_offset_t"
+		#if ( 1 == PAR_CFG_COMPACT_EN )
+			if ( ram_size > PAR_ADDR_OFFSET_RANGE )
+			{
+				status = ePAR_ERROR;
+				PAR_DBG_PRINT( "PAR: Live values of %d bytes do not fit PAR_CFG_COMPACT_OFFSET_SIZE!", ram_size );
+				PAR_ASSERT( 0 );
+			}
+		#endif
+
+		// Allocate space in RAM
+		if ( ePAR_OK == status )
+		{
+			*pp_ram_space = malloc( ram_size );
+			PAR_ASSERT( NULL != *pp_ram_space );
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Calculate total size for parameter live values
+	*
+	* @note 	This function may not be compatible with other microcontroller
+	* 			architectures as it is based on STM32 with its data alignment policy!
+	*
+	* @return		total_size - Size of all parameters in bytes
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint32_t par_calc_ram_usage(void)
+	{
+		uint32_t 					par_num			= 0UL;
+		uint32_t					total_size		= 0UL;
+		const par_type_desc_t *		p_desc			= NULL;
+
+		// For every parameter
+		for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+		{
+			// Get parameter type descriptor
+			p_desc = &g_par_type_desc[ PAR_CFG_HOT( par_num ).type ];
+
+	        // Align addresses
+	        while(( total_size % p_desc->align ) != 0 )
+	        {
+	        	total_size++;
+	        }
+
+	        // Store par RAM address offset
+	        g_par_addr_offset[par_num] = total_size;
+
+	        // Accumulate total RAM space
+	        total_size += ((uint32_t) p_desc->size * par_get_elem_num( par_num ));
+		}
+
+		return total_size;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check that parameter table is correctly defined
+*
+* @note		With "PAR_CFG_STATIC_LAYOUT_EN" table is checked at compile
+* 			time instead, see "PAR_CHECK_ROW".
+*
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_status_t	par_check_table_validy(void)
+{
+	par_status_t status = ePAR_OK;
+
+	/**
+	 * 	@note	Duplicate IDs are detected while building ID look-up
+	 * 			table, see "par_build_id_lut()".
+	 */
+
+	// For each parameter
+	for ( uint32_t i = 0; i < ePAR_NUM_OF; i++ )
+	{
+		/**
+		 * 	Check for correct MIN, MAX and DEF value definitions
+		 *
+		 *	1. Check that MAX is larger than MIN
+		 *	2. Check that DEF is equal or less than MAX
+		 *	3. Check that DEF is equal or more than MIN
+		 */
+		PAR_ASSERT( PAR_CFG_HOT( i ).type < ePAR_TYPE_NUM_OF );
+		PAR_ASSERT( g_par_type_desc[ PAR_CFG_HOT( i ).type ].pf_cmp( &PAR_CFG_HOT( i ).min, &PAR_CFG_HOT( i ).max ) < 0 );
+		PAR_ASSERT( g_par_type_desc[ PAR_CFG_HOT( i ).type ].pf_cmp( &PAR_CFG_DEF( i ), &PAR_CFG_HOT( i ).max ) <= 0 );
+		PAR_ASSERT( g_par_type_desc[ PAR_CFG_HOT( i ).type ].pf_cmp( &PAR_CFG_HOT( i ).min, &PAR_CFG_DEF( i )) <= 0 );
+
+		#if ( 1 == PAR_CFG_NVM_EN )
+
+			/**
+			 * 	Array parameter value does not fit into NVM data object, therefore
+			 * 	it can not be persistent
+			 */
+			if 	(	( par_get_elem_num( i ) > 1U )
+				&&	( true == PAR_CFG_COLD( i ).persistant ))
+			{
+				status = ePAR_ERROR;
+				PAR_DBG_PRINT( "PAR: Array parameter %d can not be persistent!", i );
+				PAR_ASSERT( 0 );
+			}
+
+		#endif
+	}
+
+	return status;
+}
+
+#endif // 0 == PAR_CFG_STATIC_LAYOUT_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Build parameter ID to parameter number look-up table
+*
+* @note		Duplicated or out of range ID is reported as error.
+*
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_status_t par_build_id_lut(void)
+{
+	par_status_t status = ePAR_OK;
+
+	#if ( 1 == PAR_CFG_ID_LUT_DIRECT_EN )
+
+		// Mark all IDs as unused
+		for ( uint32_t id = 0; id <= PAR_CFG_ID_LUT_MAX_ID; id++ )
+		{
+			gu16_par_id_lut[id] = ePAR_NUM_OF;
+		}
+
+		for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+		{
+			// ID range and uniqueness are checked at compile time
+			#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+
+				gu16_par_id_lut[ PAR_CFG_COLD( par_num ).id ] = par_num;
+
+			#else
+
+				// ID out of range
+				if ( PAR_CFG_COLD( par_num ).id > PAR_CFG_ID_LUT_MAX_ID )
+				{
+					status = ePAR_ERROR;
+					PAR_DBG_PRINT( "Parameter table error: ID out of look-up table range!" );
+					PAR_ASSERT( 0 );
+					break;
+				}
+
+				// Check for two identical IDs
+				else if ( ePAR_NUM_OF != gu16_par_id_lut[ PAR_CFG_COLD( par_num ).id ] )
+				{
+					status = ePAR_ERROR;
+					PAR_DBG_PRINT( "Parameter table error: Duplicate ID!" );
+					PAR_ASSERT( 0 );
+					break;
+				}
+				else
+				{
+					gu16_par_id_lut[ PAR_CFG_COLD( par_num ).id ] = par_num;
+				}
+
+			#endif
+		}
+
+	#else
+
+		/**
+		 * 	Insertion sort by ID
+		 *
+		 * 	@note	Parameters are usually listed in table with ascending
+		 * 			IDs, therefore sorting takes linear time in most cases.
+		 */
+		for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+		{
+			uint32_t i = par_num;
+
+			while (( i > 0 ) && ( g_par_id_lut[i-1].id > PAR_CFG_COLD( par_num ).id ))
+			{
+				g_par_id_lut[i] = g_par_id_lut[i-1];
+				i--;
+			}
+
+			g_par_id_lut[i].id 		= PAR_CFG_COLD( par_num ).id;
+			g_par_id_lut[i].par_num = par_num;
+		}
+
+		// Check for two identical IDs
+		#if ( 0 == PAR_CFG_STATIC_LAYOUT_EN )
+			for ( uint32_t i = 1; i < ePAR_NUM_OF; i++ )
+			{
+				if ( g_par_id_lut[i-1].id == g_par_id_lut[i].id )
+				{
+					status = ePAR_ERROR;
+					PAR_DBG_PRINT( "Parameter table error: Duplicate ID!" );
+					PAR_ASSERT( 0 );
+					break;
+				}
+			}
+		#endif
+
+	#endif
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find parameter number by ID in look-up table
+*
+* @param[in]	id 			- Parameter ID
+* @param[out]	p_par_num	- Pointer to parameter enumeration number
+* @return		status		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_status_t par_find_id_lut(const uint16_t id, par_num_t * const p_par_num)
+{
+	par_status_t status = ePAR_ERROR;
+
+	#if ( 1 == PAR_CFG_ID_LUT_DIRECT_EN )
+
+		if ( id <= PAR_CFG_ID_LUT_MAX_ID )
+		{
+			if ( ePAR_NUM_OF != gu16_par_id_lut[id] )
+			{
+				*p_par_num = gu16_par_id_lut[id];
+				status = ePAR_OK;
+			}
+		}
+
+	#else
+
+		uint32_t low 	= 0UL;
+		uint32_t high 	= ePAR_NUM_OF;
+		uint32_t mid	= 0UL;
+
+		// Binary search for lower bound
+		while ( low < high )
+		{
+			mid = (( low + high ) / 2U );
+
+			if ( g_par_id_lut[mid].id < id )
+			{
+				low = mid + 1U;
+			}
+			else
+			{
+				high = mid;
+			}
+		}
+
+		if 	(	( low < ePAR_NUM_OF )
+			&&	( id == g_par_id_lut[low].id ))
+		{
+			*p_par_num = g_par_id_lut[low].par_num;
+			status = ePAR_OK;
+		}
+
+	#endif
+
+	return status;
+}
+
+#if ( 1 == PAR_SHARED_READER_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Write parameter value
+	*
+	* @note		Live values are owned by other core, thus can not be written.
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @param[in]	p_val	- Pointer to value
+	* @param[in]	fill	- Same value for all array elements
+	* @return		status 	- Always ePAR_ERROR
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static par_status_t par_write(const par_num_t par_num, const void * p_val, const bool fill)
+	{
+		(void) par_num;
+		(void) p_val;
+		(void) fill;
+
+		return ePAR_ERROR;
+	}
+
+#else
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Set parameter value under mutex and notify subscribers
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @param[in]	p_val	- Pointer to value
+	* @param[in]	fill	- Same value for all array elements, see "par_set_value()"
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static par_status_t par_write(const par_num_t par_num, const void * p_val, const bool fill)
+	{
+		par_status_t status = ePAR_OK;
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				par_seq_write_begin();
+				status = par_set_value( par_num, p_val, fill );
+				par_seq_write_end();
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+
+			// Mutex not acquire
+			else
+			{
+				status = ePAR_ERROR;
+			}
+		#endif
+
+		// Notify subscribers (outside of mutex)
+		#if ( 1 == PAR_CFG_NOTIFY_EN ) && ( 0 == PAR_CFG_NOTIFY_DEFER_EN )
+			par_notify_dispatch();
+		#endif
+
+		return status;
+	}
+
+#endif // 1 == PAR_SHARED_READER_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set parameter value based on its data type
+*
+* @note		Mutex shall be handled by caller!
+*
+* 			Each element is limited to parameter range with data type
+* 			compare function and stored only if it changes. Input value is
+* 			copied byte-wise, thus it does not need to be aligned.
+*
+* 			With "fill" set, "p_val" points to single value that is set to
+* 			all elements of array parameter (e.g. default value).
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @param[in]	p_val	- Pointer to value
+* @param[in]	fill	- Same value for all array elements
+* @return		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static par_status_t par_set_value(const par_num_t par_num, const void * p_val, const bool fill)
+{
+			par_status_t 				status 		= ePAR_OK;
+	const	par_type_desc_t * const		p_desc		= &g_par_type_desc[ PAR_CFG_HOT( par_num ).type ];
+			uint8_t * 					p_dst		= &gpu8_par_value[ g_par_addr_offset[par_num] ];
+	const	uint8_t *					p_src		= (const uint8_t*) p_val;
+	const	uint16_t					elem_num	= par_get_elem_num( par_num );
+			par_type_t					val			= { 0 };
+			bool						is_changed	= false;
+
+	for ( uint16_t elem = 0U; elem < elem_num; elem++ )
+	{
+		memcpy( &val, p_src, p_desc->size );
+
+		// Limit to range
+		if ( p_desc->pf_cmp( &val, &PAR_CFG_HOT( par_num ).max ) > 0 )
+		{
+			val = PAR_CFG_HOT( par_num ).max;
+
+			#if ( 1 == PAR_CFG_STATS_EN )
+				g_par_stats.clamp_cnt++;
+			#endif
+		}
+		else if ( p_desc->pf_cmp( &val, &PAR_CFG_HOT( par_num ).min ) < 0 )
+		{
+			val = PAR_CFG_HOT( par_num ).min;
+
+			#if ( 1 == PAR_CFG_STATS_EN )
+				g_par_stats.clamp_cnt++;
+			#endif
+		}
+		else
+		{
+			// No actions...
+		}
+
+		// Store only if value changes
+		if ( 0 != memcmp( p_dst, &val, p_desc->size ))
+		{
+			par_value_store( p_dst, &val, p_desc->size );
+			is_changed = true;
+		}
+
+		p_dst += p_desc->size;
+
+		if ( true != fill )
+		{
+			p_src += p_desc->size;
+		}
+	}
+
+	if ( true == is_changed )
+	{
+		par_on_change( par_num );
+	}
+
+	par_loaded_mark( par_num );
+
+	return status;
+}
+
+#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Write default values image to live values
+	*
+	* @note		Defaults are checked at compile time, thus are not limited.
+	* 			Only changed values are stored, each with single store as
+	* 			lock-free readers might be running. All under single mutex
+	* 			hold.
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static par_status_t par_write_def_image(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		#if ( 1 == PAR_SHARED_READER_EN )
+
+			// Live values are owned by other core
+			status = ePAR_ERROR;
+
+		#else
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					par_seq_write_begin();
+
+					for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+					{
+						const	uint32_t	offset		= g_par_addr_offset[par_num];
+						const	uint8_t		size		= g_par_type_desc[ PAR_CFG_HOT( par_num ).type ].size;
+						const	uint16_t	elem_num	= par_get_elem_num( par_num );
+								bool		is_changed	= false;
+								par_type_t	val			= { 0 };
+
+						memcpy( &val, &gpu8_par_def_image[offset], size );
+
+						// Array elements are compared with default of first one
+						for ( uint16_t elem = 0U; elem < elem_num; elem++ )
+						{
+							if ( 0 != memcmp( &gpu8_par_value[ offset + ( elem * size ) ], &val, size ))
+							{
+								par_value_store( &gpu8_par_value[ offset + ( elem * size ) ], &val, size );
+								is_changed = true;
+							}
+						}
+
+						if ( true == is_changed )
+						{
+							par_on_change( par_num );
+						}
+
+						par_loaded_mark( par_num );
+					}
+
+					par_seq_write_end();
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+
+				// Mutex not acquire
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			#endif
+
+			// Notify subscribers (outside of mutex)
+			#if ( 1 == PAR_CFG_NOTIFY_EN ) && ( 0 == PAR_CFG_NOTIFY_DEFER_EN )
+				par_notify_dispatch();
+			#endif
+
+		#endif
+
+		return status;
+	}
+
+	#if ( 1 == PAR_CFG_ARRAY_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Set all elements of array parameters to default
+		*
+		* @note		Default image holds only first element of array parameter,
+		* 			it is repeated to rest of elements. Called at init after
+		* 			copy of default image, while live values are not yet used.
+		*
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static void par_fill_arrays(void)
+		{
+			for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+			{
+				const	uint32_t	offset		= g_par_addr_offset[par_num];
+				const	uint8_t		size		= g_par_type_desc[ PAR_CFG_HOT( par_num ).type ].size;
+				const	uint16_t	elem_num	= par_get_elem_num( par_num );
+
+				for ( uint16_t elem = 1U; elem < elem_num; elem++ )
+				{
+					memcpy( &gpu8_par_value[ offset + ( elem * size ) ], &gpu8_par_value[offset], size );
+				}
+			}
+		}
+
+	#endif
+
+#endif // 1 == PAR_CFG_STATIC_LAYOUT_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get parameter value based on its data type
+*
+* @note		Mutex shall be handled by caller!
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @param[out]	p_val	- Parameter value
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_get_value(const par_num_t par_num, void * const p_val)
+{
+	const uint8_t size = g_par_type_desc[ PAR_CFG_HOT( par_num ).type ].size;
+
+	// Single load, value might be set from ISR
+	if ( true == par_is_isr_safe( par_num ))
+	{
+		par_type_t val = { 0 };
+
+		par_value_load( &gpu8_par_value[ g_par_addr_offset[par_num] ], &val, size );
+		memcpy( p_val, &val, size );
+	}
+	else
+	{
+		memcpy( p_val, &gpu8_par_value[ g_par_addr_offset[par_num] ], ((uint32_t) size * par_get_elem_num( par_num )));
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of parameter value elements
+*
+* @param[in]	par_num		- Parameter number (enumeration)
+* @return		elem_num	- Number of elements, 1 for single value parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint16_t par_get_elem_num(const par_num_t par_num)
+{
+	uint16_t elem_num = 1U;
+
+	#if ( 1 == PAR_CFG_ARRAY_EN )
+		if ( PAR_CFG_HOT( par_num ).len > 1U )
+		{
+			elem_num = PAR_CFG_HOT( par_num ).len;
+		}
+	#else
+		(void) par_num;
+	#endif
+
+	return elem_num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if parameter can be accessed from interrupt context
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		safe	- True for scalar parameter of up to 32-bit
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline bool par_is_isr_safe(const par_num_t par_num)
+{
+	return (( g_par_type_desc[ PAR_CFG_HOT( par_num ).type ].size <= 4U ) && ( 1U == par_get_elem_num( par_num )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Store single value element into live values buffer
+*
+* @note		Values of up to 32-bit are aligned to its size, thus are
+* 			written with single store, so that lock-free readers (typed
+* 			getters, "par_get_isr()") never observe torn value.
+*
+* @param[out]	p_dst	- Pointer to value inside live values buffer
+* @param[in]	p_val	- Value to store
+* @param[in]	size	- Size of value in bytes
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void par_value_store(uint8_t * const p_dst, const par_type_t * const p_val, const uint8_t size)
+{
+	switch ( size )
+	{
+		case 1U:
+			*(volatile uint8_t*) p_dst = p_val->u8;
+			break;
+
+		case 2U:
+			*(volatile uint16_t*) p_dst = p_val->u16;
+			break;
+
+		case 4U:
+			*(volatile uint32_t*) p_dst = p_val->u32;
+			break;
+
+		default:
+			memcpy( p_dst, p_val, size );
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load single value element from live values buffer
+*
+* @note		Counterpart of "par_value_store()".
+*
+* @param[in]	p_src	- Pointer to value inside live values buffer
+* @param[out]	p_val	- Loaded value
+* @param[in]	size	- Size of value in bytes
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void par_value_load(const uint8_t * const p_src, par_type_t * const p_val, const uint8_t size)
+{
+	switch ( size )
+	{
+		case 1U:
+			p_val->u8 = *(const volatile uint8_t*) p_src;
+			break;
+
+		case 2U:
+			p_val->u16 = *(const volatile uint16_t*) p_src;
+			break;
+
+		case 4U:
+			p_val->u32 = *(const volatile uint32_t*) p_src;
+			break;
+
+		default:
+			memcpy( p_val, p_src, size );
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Validate batch of parameters
+*
+* @param[in]	p_par_num	- Pointer to parameter numbers (enumerations)
+* @param[in]	pp_val		- Pointer to parameter value pointers
+* @param[in]	num			- Number of parameters
+* @return		valid		- True if all parameter numbers and pointers are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool par_is_batch_valid(const par_num_t * const p_par_num, const void * const * const pp_val, const uint32_t num)
+{
+	bool valid = false;
+
+	if 	(	( NULL != p_par_num )
+		&&	( NULL != pp_val )
+		&&	( num > 0 ))
+	{
+		valid = true;
+
+		for ( uint32_t i = 0; i < num; i++ )
+		{
+			if 	(	( p_par_num[i] >= ePAR_NUM_OF )
+				||	( NULL == pp_val[i] ))
+			{
+				valid = false;
+				break;
+			}
+		}
+	}
+
+	return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Mark start of live values write
+*
+* @note		Writers shall be serialized by mutex!
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void par_seq_write_begin(void)
+{
+	#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+		gp_par_seq->seq = gp_par_seq->seq + 1U;
+		PAR_MEMORY_BARRIER();
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Mark end of live values write
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void par_seq_write_end(void)
+{
+	#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+		PAR_MEMORY_BARRIER();
+		gp_par_seq->seq = gp_par_seq->seq + 1U;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Parameter live value changed
+*
+* @note		Called only when stored value actually changes. Mutex is being
+* 			held by caller!
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void par_on_change(const par_num_t par_num)
+{
+	#if ( 1 == PAR_CFG_NVM_EN )
+
+		// Mark persistent parameter for storing to NVM
+		if ( true == PAR_CFG_COLD( par_num ).persistant )
+		{
+			gu32_par_dirty[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+		}
+
+	#endif
+
+	par_on_change_notify( par_num );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Parameter live value changed without storing request
+*
+* @note		Called only when stored value actually changes. Mutex is being
+* 			held by caller!
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void par_on_change_notify(const par_num_t par_num)
+{
+	#if ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+
+		// Record time of change
+		gp_par_seq->change_seq++;
+		gp_par_seq->change_seq_par[ par_num ] = gp_par_seq->change_seq;
+
+	#endif
+
+	#if ( 1 == PAR_CFG_NOTIFY_EN )
+
+		// Mark parameter for notification
+		gu32_par_notify_pending[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+		gb_par_notify_pending = true;
+
+	#endif
+
+	(void) par_num;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Get signed 32-bit parameter
+*		Mark parameter value as final
+*
+* @note		Mutex is being held by caller! Has effect only with lazy loading
+* 			from NVM, so that stored value does not override written one.
 *
 * @param[in]	par_num	- Parameter number (enumeration)
-* @return		value   - Value of parameter
+* @return		void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static int32_t par_get_i32(const par_num_t par_num)
+static inline void par_loaded_mark(const par_num_t par_num)
 {
-    return *(int32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ];
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		gu32_par_loaded[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+	#endif
+
+	(void) par_num;
 }
 
+#if ( 1 == PAR_CFG_NVM_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get and clear parameter dirty flag
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @return		dirty	- True if parameter changed since last store
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static bool par_dirty_take(const par_num_t par_num)
+	{
+		bool dirty = false;
+
+		if ( par_num < ePAR_NUM_OF )
+		{
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					dirty = ( 0UL != ( gu32_par_dirty[ par_num / 32U ] & ( 1UL << ( par_num % 32U ))));
+					gu32_par_dirty[ par_num / 32U ] &= ~( 1UL << ( par_num % 32U ));
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+			#endif
+		}
+
+		return dirty;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get and clear one word of dirty bitmap
+	*
+	* @param[in]	word	- Index of 32-bit word in dirty bitmap
+	* @return		dirty	- Dirty flags of parameters [word*32, word*32+31]
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint32_t par_dirty_take_word(const uint32_t word)
+	{
+		uint32_t dirty = 0UL;
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				dirty = gu32_par_dirty[word];
+				gu32_par_dirty[word] = 0UL;
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+
+		return dirty;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Mark parameter as dirty again
+	*
+	* @note		Used when storing to NVM fails, so that value is not lost.
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_dirty_restore(const par_num_t par_num)
+	{
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				gu32_par_dirty[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Mark parameters of one dirty bitmap word as dirty again
+	*
+	* @note		Used when storing to NVM fails, so that values are not lost.
+	*
+	* @param[in]	word	- Index of 32-bit word in dirty bitmap
+	* @param[in]	dirty	- Dirty flags of parameters [word*32, word*32+31]
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_dirty_restore_word(const uint32_t word, const uint32_t dirty)
+	{
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				gu32_par_dirty[word] |= dirty;
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Clear all dirty flags
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_dirty_clear_all(void)
+	{
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				memset( gu32_par_dirty, 0, sizeof( gu32_par_dirty ));
+
+				#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+					memset( gu32_par_wb_pending, 0, sizeof( gu32_par_wb_pending ));
+					gb_par_wb_pending = false;
+				#endif
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+	}
+
+#endif // 1 == PAR_CFG_NVM_EN
+
+#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Mark only non-persistent parameters as loaded
+	*
+	* @note		Called at init after parameters are set to default.
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_loaded_reset(void)
+	{
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				memset( gu32_par_loaded, 0, sizeof( gu32_par_loaded ));
+
+				for ( uint32_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+				{
+					if ( true != PAR_CFG_COLD( par_num ).persistant )
+					{
+						gu32_par_loaded[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+					}
+				}
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Load parameter from NVM if not loaded yet
+	*
+	* @note		Loaded flag is read without mutex, as it is only a hint.
+	* 			Flag is checked again by "par_set_loaded()".
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_load_on_demand(const par_num_t par_num)
+	{
+		if 	(	( par_num < ePAR_NUM_OF )
+			&&	( 0UL == ( gu32_par_loaded[ par_num / 32U ] & ( 1UL << ( par_num % 32U )))))
+		{
+			(void) par_nvm_load( par_num );
+
+			par_load_notify();
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Notify subscribers of parameters loaded from NVM
+	*
+	* @note		Values loaded from NVM are only marked for notification, as
+	* 			NVM mutex is held while loading. Must be called once NVM
+	* 			module returns, so that subscriber can access parameters.
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_load_notify(void)
+	{
+		#if ( 1 == PAR_CFG_NOTIFY_EN ) && ( 0 == PAR_CFG_NOTIFY_DEFER_EN )
+			par_notify_dispatch();
+		#endif
+	}
+
+#endif // 1 == PAR_CFG_NVM_LAZY_EN
+
+#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Schedule parameter for deferred store to NVM
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_wb_schedule(const par_num_t par_num)
+	{
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				gu32_par_wb_pending[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+				gu32_par_wb_last_ms = par_if_get_time_ms();
+
+				// First request since last flush
+				if ( false == gb_par_wb_pending )
+				{
+					gu32_par_wb_first_ms 	= gu32_par_wb_last_ms;
+					gb_par_wb_pending 		= true;
+				}
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Store all scheduled parameters to NVM
+	*
+	* @brief	Only scheduled parameters which value differs from NVM are
+	* 			written, followed by single NVM sync. Parameter that fails to
+	* 			be written is scheduled again.
+	*
+	* 			Unless forced, parameter not allowed by its persistence policy
+	* 			(PAR_CFG_NVM_POLICY_EN) stays pending and its value in NVM.
+	*
+	* @param[in]	force	- Ignore persistence policy
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static par_status_t par_wb_flush(const bool force)
+	{
+		par_status_t 	status 		= ePAR_OK;
+		par_status_t 	par_status	= ePAR_OK;
+		uint32_t		pending		= 0UL;
+		uint32_t		par_num		= 0UL;
+		bool			written		= false;
+
+		#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+			const uint32_t	now_ms	= par_if_get_time_ms();
+			par_wb_policy_t	policy	= ePAR_WB_STORE;
+		#else
+			(void) force;
+		#endif
+
+		for ( uint32_t word = 0; word < PAR_DIRTY_WORD_NUM; word++ )
+		{
+			// Take scheduled parameters
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					pending = gu32_par_wb_pending[word];
+					gu32_par_wb_pending[word] = 0UL;
+
+					// Requests issued during flush start new period
+					if ( 0U == word )
+					{
+						gb_par_wb_pending = false;
+					}
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+
+				// Mutex not acquire
+				else
+				{
+					pending = 0UL;
+					status |= ePAR_ERROR;
+				}
+			#endif
+
+			for ( uint32_t bit = 0; ( bit < 32U ) && ( 0UL != pending ); bit++ )
+			{
+				if ( 0UL == ( pending & ( 1UL << bit )))
+				{
+					continue;
+				}
+
+				pending &= ~( 1UL << bit );
+				par_num = ( word * 32U ) + bit;
+
+				// Value already in NVM
+				if ( false == par_dirty_take( par_num ))
+				{
+					continue;
+				}
+
+				#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+					if ( false == force )
+					{
+						policy = par_wb_policy_check( par_num, now_ms );
+
+						if ( ePAR_WB_STORE != policy )
+						{
+							par_dirty_restore( par_num );
+
+							if ( ePAR_WB_RETRY == policy )
+							{
+								par_wb_schedule( par_num );
+							}
+							else
+							{
+								par_wb_policy_hold( par_num );
+							}
+
+							continue;
+						}
+					}
+				#endif
+
+				// Sync will be done later
+				par_status = par_nvm_write( par_num, false );
+
+				if ( ePAR_OK == par_status )
+				{
+					written = true;
+
+					#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+						par_wb_policy_stored( par_num, now_ms );
+					#endif
+				}
+				else
+				{
+					par_dirty_restore( par_num );
+					par_wb_schedule( par_num );
+				}
+
+				status |= par_status;
+			}
+		}
+
+		if ( true == written )
+		{
+			status |= par_nvm_sync();
+		}
+
+		// Values loaded while storing
+		#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+			par_load_notify();
+		#endif
+
+		return status;
+	}
+
+	#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Check persistence policy of scheduled parameter
+		*
+		* @note		Interval and delta are checked only when parameter was
+		* 			already stored by write-back since init.
+		*
+		* @param[in]	par_num	- Parameter number (enumeration)
+		* @param[in]	now_ms	- Current time
+		* @return		policy	- Policy decision
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_wb_policy_t par_wb_policy_check(const par_num_t par_num, const uint32_t now_ms)
+		{
+			const 	par_nvm_policy_t * const	p_policy	= &PAR_CFG_COLD( par_num ).policy;
+					par_wb_policy_t				policy		= ePAR_WB_STORE;
+					par_type_t					val			= { 0 };
+
+			if ( true == p_policy->shutdown_only )
+			{
+				policy = ePAR_WB_HOLD;
+			}
+			else if ( 0UL != ( gu32_par_wb_stored_valid[ par_num / 32U ] & ( 1UL << ( par_num % 32U ))))
+			{
+				if (( now_ms - gu32_par_wb_stored_ms[ par_num ] ) < p_policy->interval_ms )
+				{
+					policy = ePAR_WB_RETRY;
+				}
+				else
+				{
+					#if ( 1 == PAR_CFG_MUTEX_EN )
+						if ( ePAR_OK == par_aquire_mutex())
+						{
+					#endif
+							par_get_value( par_num, &val );
+
+					#if ( 1 == PAR_CFG_MUTEX_EN )
+							par_if_release_mutex();
+						}
+					#endif
+
+					if ( false == g_par_type_desc[ PAR_CFG_HOT( par_num ).type ].pf_delta( &val, &g_par_wb_stored[ par_num ], &p_policy->delta ))
+					{
+						policy = ePAR_WB_HOLD;
+					}
+				}
+			}
+			else
+			{
+				// First store since init
+			}
+
+			return policy;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Keep parameter pending without write-back timing
+		*
+		* @brief	Held parameter is re-checked by next flush or stored by
+		* 			"par_flush()".
+		*
+		* @param[in]	par_num	- Parameter number (enumeration)
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static void par_wb_policy_hold(const par_num_t par_num)
+		{
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					gu32_par_wb_pending[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+			#endif
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Remember value and time of write-back store
+		*
+		* @param[in]	par_num	- Parameter number (enumeration)
+		* @param[in]	now_ms	- Time of store
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static void par_wb_policy_stored(const par_num_t par_num, const uint32_t now_ms)
+		{
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+				if ( ePAR_OK == par_aquire_mutex())
+				{
+			#endif
+					par_get_value( par_num, &g_par_wb_stored[ par_num ] );
+					gu32_par_wb_stored_ms[ par_num ] = now_ms;
+					gu32_par_wb_stored_valid[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+
+			#if ( 1 == PAR_CFG_MUTEX_EN )
+					par_if_release_mutex();
+				}
+			#endif
+		}
+
+	#endif // 1 == PAR_CFG_NVM_POLICY_EN
+
+#endif // 1 == PAR_CFG_NVM_WRITE_BACK_EN
+
+#if ( 1 == PAR_CFG_PROFILE_EN ) && ( 1 == PAR_CFG_NVM_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Load all parameter profiles from NVM
+	*
+	* @note		Profile with empty or corrupted NVM slot is left empty.
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_profile_load_all(void)
+	{
+		for ( uint8_t profile = 0U; profile < PAR_CFG_PROFILE_NUM; profile++ )
+		{
+			if ( ePAR_OK != par_nvm_profile_read( profile, &g_par_profile[profile] ))
+			{
+				g_par_profile[profile].num = 0U;
+				PAR_DBG_PRINT( "PAR: Profile %d not stored in NVM", profile );
+			}
+		}
+	}
+
+#endif
+
+#if ( 1 == PAR_CFG_NOTIFY_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get and clear one word of pending notifications bitmap
+	*
+	* @param[in]	word	- Index of 32-bit word in bitmap
+	* @return		pending	- Pending flags of parameters [word*32, word*32+31]
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint32_t par_notify_take_word(const uint32_t word)
+	{
+		uint32_t pending = 0UL;
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				pending = gu32_par_notify_pending[word];
+				gu32_par_notify_pending[word] = 0UL;
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+
+		return pending;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Call subscribers of changed parameters
+	*
+	* @note		Must not be called while mutex is held!
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_notify_dispatch(void)
+	{
+		uint32_t 	pending = 0UL;
+		par_num_t	par_num	= 0;
+
+		if ( true == gb_par_notify_pending )
+		{
+			gb_par_notify_pending = false;
+
+			for ( uint32_t word = 0; word < PAR_NOTIFY_WORD_NUM; word++ )
+			{
+				pending = par_notify_take_word( word );
+
+				for ( uint32_t bit = 0; ( bit < 32U ) && ( 0UL != pending ); bit++ )
+				{
+					if ( 0UL == ( pending & ( 1UL << bit )))
+					{
+						continue;
+					}
+
+					pending &= ~( 1UL << bit );
+					par_num = ( word * 32U ) + bit;
+
+					for ( uint32_t i = 0; i < PAR_CFG_NOTIFY_SUB_NUM; i++ )
+					{
+						const par_sub_t sub = g_par_sub[i];
+
+						if 	(	( NULL != sub.cb )
+							&&	(	( par_num == sub.par_num )
+								||	( ePAR_NUM_OF == sub.par_num )))
+						{
+							sub.cb( par_num, sub.p_ctx );
+						}
+					}
+				}
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Clear all pending notifications
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_notify_clear_all(void)
+	{
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+			if ( ePAR_OK == par_aquire_mutex())
+			{
+		#endif
+				memset( gu32_par_notify_pending, 0, sizeof( gu32_par_notify_pending ));
+				gb_par_notify_pending = false;
+
+		#if ( 1 == PAR_CFG_MUTEX_EN )
+				par_if_release_mutex();
+			}
+		#endif
+	}
+
+#endif // 1 == PAR_CFG_NOTIFY_EN
+
+#if ( 1 == PAR_CFG_MUTEX_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Acquire mutex
+	*
+	* @note		Wraps "par_if_aquire_mutex()" to account failed acquisitions
+	* 			and wait time when statistics are enabled.
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static inline par_status_t par_aquire_mutex(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+			const uint32_t ts_start = par_if_get_ts();
+		#elif ( 1 == PAR_CFG_STATS_EN )
+			const uint32_t ts_start = 0UL;
+		#endif
+
+		status = par_if_aquire_mutex();
+
+		#if ( 1 == PAR_CFG_STATS_EN )
+			par_stats_mutex_add( status, ts_start );
+		#endif
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Acquire mutex for reading
+	*
+	* @note		Shared (reader) lock when "PAR_CFG_MUTEX_RW_EN" is enabled,
+	* 			otherwise the same as "par_aquire_mutex()". Shall be released
+	* 			with "par_release_mutex_rd()".
+	*
+	* 			Only live values and change sequences may be read while
+	* 			holding reader lock.
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static inline par_status_t par_aquire_mutex_rd(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		#if ( 1 == PAR_CFG_MUTEX_RW_EN )
+
+			#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+				const uint32_t ts_start = par_if_get_ts();
+			#elif ( 1 == PAR_CFG_STATS_EN )
+				const uint32_t ts_start = 0UL;
+			#endif
+
+			status = par_if_aquire_mutex_rd();
+
+			#if ( 1 == PAR_CFG_STATS_EN )
+				par_stats_mutex_add( status, ts_start );
+			#endif
+
+		#else
+			status = par_aquire_mutex();
+		#endif
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Release mutex for reading
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static inline void par_release_mutex_rd(void)
+	{
+		#if ( 1 == PAR_CFG_MUTEX_RW_EN )
+			(void) par_if_release_mutex_rd();
+		#else
+			(void) par_if_release_mutex();
+		#endif
+	}
+
+	#if ( 1 == PAR_CFG_STATS_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Account mutex acquisition
+		*
+		* @note		Readers might account at the same time, thus mutex
+		* 			statistics are approximate with "PAR_CFG_MUTEX_RW_EN".
+		*
+		* @param[in]	status		- Status of mutex acquisition
+		* @param[in]	ts_start	- Timestamp before acquisition
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static inline void par_stats_mutex_add(const par_status_t status, const uint32_t ts_start)
+		{
+			if ( ePAR_OK != status )
+			{
+				g_par_stats.mutex_err_cnt++;
+			}
+
+			#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+				else
+				{
+					par_stats_lat_add( &g_par_stats.mutex_wait, ( par_if_get_ts() - ts_start ));
+				}
+			#else
+				(void) ts_start;
+			#endif
+		}
+
+	#endif
+
+#endif
+
+#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Add latency measurement
+	*
+	* @param[in]	p_lat	- Pointer to latency statistics
+	* @param[in]	lat		- Measured latency in "par_if_get_ts()" units
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_stats_lat_add(par_stats_lat_t * const p_lat, const uint32_t lat)
+	{
+		if (( 0UL == p_lat->cnt ) || ( lat < p_lat->min ))
+		{
+			p_lat->min = lat;
+		}
+
+		if ( lat > p_lat->max )
+		{
+			p_lat->max = lat;
+		}
+
+		p_lat->sum += lat;
+		p_lat->cnt++;
+	}
+
+#endif
+
+#if ( 1 == PAR_SHARED_READER_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Check shared memory initialized by owner core
+	*
+	* @note		Owner core shall finish "par_init()" first. Layout size is
+	* 			compared to catch cores built with different parameter table.
+	*
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static par_status_t par_shared_check(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		if 	(	( PAR_SHARED_READY != PAR_CFG_SHARED_SYMBOL.ready )
+			||	( sizeof( par_layout_t ) != PAR_CFG_SHARED_SYMBOL.size ))
+		{
+			status = ePAR_ERROR;
+
+			PAR_DBG_PRINT( "PAR: Shared memory not initialized by owner core!" );
+		}
+
+		// Order following reads of live values after ready flag
+		PAR_MEMORY_BARRIER();
+
+		return status;
+	}
+
+#elif ( 1 == PAR_CFG_SHARED_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Reset shared memory
+	*
+	* @note		Shared memory is not initialized by startup code, thus
+	* 			sequence counters are cleared here. Live values are set to
+	* 			default afterwards.
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_shared_reset(void)
+	{
+		PAR_CFG_SHARED_SYMBOL.ready = 0UL;
+		PAR_MEMORY_BARRIER();
+
+		PAR_CFG_SHARED_SYMBOL.size = sizeof( par_layout_t );
+
+		#if ( 1 == PAR_CFG_SNAPSHOT_EN ) || ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+			memset( gp_par_seq, 0, sizeof( par_seq_t ));
+		#endif
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Publish shared memory to other cores
+	*
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_shared_publish(void)
+	{
+		// Live values written before ready flag
+		PAR_MEMORY_BARRIER();
+		PAR_CFG_SHARED_SYMBOL.ready = PAR_SHARED_READY;
+	}
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Get floating value parameter
+*		Three-way compare functions of each data type
 *
-* @param[in]	par_num	- Parameter number (enumeration)
-* @return		value   - Value of parameter
+* @param[in]	p_a	- Pointer to first value
+* @param[in]	p_b	- Pointer to second value
+* @return		cmp	- Negative if a < b, zero if equal and positive if a > b
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t par_get_f32(const par_num_t par_num)
-{
-    return *(float32_t*)&gpu8_par_value[ gu32_par_addr_offset[par_num] ];
-}
+PAR_TYPE_CMP_FUNC( u8 )
+PAR_TYPE_CMP_FUNC( i8 )
+PAR_TYPE_CMP_FUNC( u16 )
+PAR_TYPE_CMP_FUNC( i16 )
+PAR_TYPE_CMP_FUNC( u32 )
+PAR_TYPE_CMP_FUNC( i32 )
+PAR_TYPE_CMP_FUNC( f32 )
+
+#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+	PAR_TYPE_CMP_FUNC( u64 )
+	PAR_TYPE_CMP_FUNC( i64 )
+#endif
+
+#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN ) && ( 1 == PAR_CFG_NVM_POLICY_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Delta functions of each data type
+	*
+	* @param[in]	p_a		- Pointer to first value
+	* @param[in]	p_b		- Pointer to second value
+	* @param[in]	p_th	- Pointer to threshold
+	* @return		reached	- True if |a - b| >= threshold
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	PAR_TYPE_DELTA_FUNC( u8, uint8_t )
+	PAR_TYPE_DELTA_FUNC( i8, uint8_t )
+	PAR_TYPE_DELTA_FUNC( u16, uint16_t )
+	PAR_TYPE_DELTA_FUNC( i16, uint16_t )
+	PAR_TYPE_DELTA_FUNC( u32, uint32_t )
+	PAR_TYPE_DELTA_FUNC( i32, uint32_t )
+	PAR_TYPE_DELTA_FUNC( f32, float32_t )
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		PAR_TYPE_DELTA_FUNC( u64, uint64_t )
+		PAR_TYPE_DELTA_FUNC( i64, uint64_t )
+	#endif
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
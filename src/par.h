@@ -74,6 +74,14 @@ typedef enum
 	ePAR_TYPE_I16,		/**<Signed 16-bit value */
 	ePAR_TYPE_I32,		/**<Signed 32-bit value */
 	ePAR_TYPE_F32,		/**<32-bit floating value */
+	ePAR_TYPE_Q15,		/**<Signed Q15 fixed-point value */
+	ePAR_TYPE_Q31,		/**<Signed Q31 fixed-point value */
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		ePAR_TYPE_U64,	/**<Unsigned 64-bit value */
+		ePAR_TYPE_I64,	/**<Signed 64-bit value */
+	#endif
+
 	ePAR_TYPE_NUM_OF
 }par_type_list_t;
 
@@ -91,6 +99,15 @@ typedef enum
  */
 typedef float float32_t;
 
+/**
+ *  Fixed-point data types definition
+ *
+ * @note	Raw Q15 and Q31 values, range and comparisons are the same
+ * 			as for signed 16 and 32-bit integers.
+ */
+typedef int16_t par_q15_t;
+typedef int32_t par_q31_t;
+
 /**
  * 	Supported data types
  */
@@ -103,6 +120,13 @@ typedef union
 	int16_t			i16;		/**<Signed 16-bit value */
 	int32_t			i32;		/**<Signed 32-bit value */
 	float32_t		f32;		/**<32-bit floating value */
+	par_q15_t		q15;		/**<Signed Q15 fixed-point value */
+	par_q31_t		q31;		/**<Signed Q31 fixed-point value */
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		uint64_t	u64;		/**<Unsigned 64-bit value */
+		int64_t		i64;		/**<Signed 64-bit value */
+	#endif
 } par_type_t;
 
 /**
@@ -114,11 +138,41 @@ typedef struct
     par_type_t max; /**<Maximum value */
 } par_range_t;
 
+#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+
+	/**
+	 * 	Parameter NVM persistence policy
+	 *
+	 * @note	Applied only to deferred write-back of "par_set_n_save()".
+	 * 			Zero policy sets no limit. "par_flush()" and explicit
+	 * 			saves (e.g. "par_save()") store regardless of policy.
+	 *
+	 * 			Interval and delta are checked against value of last
+	 * 			write-back store, first store after init is never limited.
+	 */
+	typedef struct
+	{
+		uint32_t	interval_ms;	/**<Minimum time between two stores, unit: ms */
+		par_type_t	delta;			/**<Minimum absolute change against stored value, of parameter type */
+		bool		shutdown_only;	/**<Store only by "par_flush()" */
+	} par_nvm_policy_t;
+
+#endif
+
 /**
  * 	Parameter data settings
  *
- * @note	Single parameter object has size of 28 bytes on
- * 			arm-gcc compiler.
+ * @note	Single parameter object has size of 32 bytes on
+ * 			arm-gcc compiler with 32-bit data types, "len" and
+ * 			"critical" fit into its padding.
+ *
+ * 			Array parameter ("len" larger than 1) holds "len" elements
+ * 			of "type", each limited to min/max range and all set to
+ * 			default value. Requires "PAR_CFG_ARRAY_EN".
+ *
+ * 			"critical" flag is part of settings only with lazy loading
+ * 			("PAR_CFG_NVM_LAZY_EN"), "policy" only with persistence
+ * 			policy ("PAR_CFG_NVM_POLICY_EN").
  */
 typedef struct
 {
@@ -129,11 +183,356 @@ typedef struct
 	const char *		unit;			/**<Unit of parameter */
 	const char * 		desc;			/**<Parameter description */
 	uint16_t			id;				/**<Variable ID */
+
+	#if ( 1 == PAR_CFG_ARRAY_EN )
+		uint16_t		len;			/**<Number of array elements, 0 or 1 for single value */
+	#endif
+
 	par_type_list_t		type;			/**<Parameter type */
 	par_io_acess_t 		access;			/**<Parameter access from external device point-of-view */
  	bool				persistant;		/**<Parameter persistence flag */
+
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		bool			critical;		/**<Load from NVM at init */
+	#endif
+
+	#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+		par_nvm_policy_t	policy;		/**<NVM write-back persistence policy */
+	#endif
 } par_cfg_t;
 
+/**
+ * 	Parameter hot data settings
+ *
+ * @note	Part of settings touched at each value change. Used only
+ * 			with "PAR_CFG_TABLE_SOA_EN".
+ */
+typedef struct
+{
+ 	par_type_t			min;			/**<Minimum value of parameter */
+	par_type_t			max;			/**<Maximum value of parameter */
+	par_type_list_t		type;			/**<Parameter type */
+
+	#if ( 1 == PAR_CFG_ARRAY_EN )
+		uint16_t		len;			/**<Number of array elements, 0 or 1 for single value */
+	#endif
+} par_cfg_hot_t;
+
+/**
+ * 	Parameter cold data settings
+ *
+ * @note	Part of settings used mainly for description of parameter
+ * 			towards external device. Used only with "PAR_CFG_TABLE_SOA_EN".
+ */
+typedef struct
+{
+	const char *		name;			/**<Name of variable */
+	const char *		unit;			/**<Unit of parameter */
+	const char * 		desc;			/**<Parameter description */
+	uint16_t			id;				/**<Variable ID */
+	par_io_acess_t 		access;			/**<Parameter access from external device point-of-view */
+ 	bool				persistant;		/**<Parameter persistence flag */
+
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		bool			critical;		/**<Load from NVM at init */
+	#endif
+
+	#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+		par_nvm_policy_t	policy;		/**<NVM write-back persistence policy */
+	#endif
+} par_cfg_cold_t;
+
+#if ( 1 == PAR_CFG_PROFILE_EN )
+
+	/**
+	 * 	Parameter profile entry
+	 */
+	typedef struct
+	{
+		par_type_t	val;		/**<Parameter value */
+		par_num_t	par_num;	/**<Parameter number (enumeration) */
+	} par_profile_entry_t;
+
+	/**
+	 * 	Parameter profile
+	 *
+	 * @note	Overlay of parameters with value different from default,
+	 * 			entries are ordered by parameter number.
+	 */
+	typedef struct
+	{
+		par_profile_entry_t	entry[ PAR_CFG_PROFILE_ENTRY_NUM ];	/**<Overlay entries */
+		uint16_t			num;								/**<Number of used entries */
+	} par_profile_t;
+
+#endif
+
+#if ( 1 == PAR_CFG_STATS_EN )
+
+	/**
+	 * 	Latency statistics
+	 *
+	 * @note	In units of "par_if_get_ts()" timestamp. Average latency
+	 * 			is "sum / cnt".
+	 */
+	typedef struct
+	{
+		uint64_t	sum;		/**<Sum of all measurements */
+		uint32_t	cnt;		/**<Number of measurements */
+		uint32_t	min;		/**<Minimum latency */
+		uint32_t	max;		/**<Maximum latency */
+	} par_stats_lat_t;
+
+	/**
+	 * 	NVM access statistics
+	 */
+	typedef struct
+	{
+		uint32_t	rd_cnt;			/**<Number of NVM reads */
+		uint32_t	wr_cnt;			/**<Number of NVM writes */
+		uint32_t	erase_cnt;		/**<Number of NVM erases */
+		uint32_t	sync_cnt;		/**<Number of NVM syncs */
+		uint32_t	rd_bytes;		/**<Number of bytes read */
+		uint32_t	wr_bytes;		/**<Number of bytes written */
+		uint32_t	crc_err_cnt;	/**<Number of CRC failures of NVM header and data objects */
+	} par_stats_nvm_t;
+
+	/**
+	 * 	Runtime statistics
+	 *
+	 * @note	Counters are not protected against concurrent update, thus
+	 * 			single increment might be lost under heavy contention.
+	 */
+	typedef struct
+	{
+		uint32_t			set_cnt;		/**<Number of "par_set()" calls */
+		uint32_t			get_cnt;		/**<Number of "par_get()" calls */
+		uint32_t			set_batch_cnt;	/**<Number of "par_set_batch()" calls */
+		uint32_t			get_batch_cnt;	/**<Number of "par_get_batch()" calls */
+		uint32_t			id_lookup_cnt;	/**<Number of "par_get_num_by_id()" calls */
+		uint32_t			clamp_cnt;		/**<Number of values limited to parameter range */
+		uint32_t			mutex_err_cnt;	/**<Number of failed mutex acquisitions */
+
+		#if ( 1 == PAR_CFG_STATS_TIMING_EN )
+			par_stats_lat_t	mutex_wait;		/**<Mutex acquisition wait time */
+			par_stats_lat_t	set_lat;		/**<Latency of "par_set()" */
+			par_stats_lat_t	get_lat;		/**<Latency of "par_get()" */
+		#endif
+
+		#if ( 1 == PAR_CFG_NVM_EN )
+			par_stats_nvm_t	nvm;			/**<NVM access */
+		#endif
+	} par_stats_t;
+
+#endif
+
+/**
+ * 	Live value address offset
+ *
+ * @note	Offset inside live values buffer, see "PAR_CFG_COMPACT_EN".
+ */
+#if ( 1 == PAR_CFG_COMPACT_EN ) && ( 1 == PAR_CFG_COMPACT_OFFSET_SIZE )
+	typedef uint8_t 	par_addr_offset_t;
+#elif ( 1 == PAR_CFG_COMPACT_EN )
+	typedef uint16_t 	par_addr_offset_t;
+#else
+	typedef uint32_t 	par_addr_offset_t;
+#endif
+
+/**
+ * 	Memory usage of module
+ *
+ * @note	Parameter names, units and descriptions strings are not
+ * 			included, neither is interface (par_if.c).
+ *
+ * 	Unit: byte
+ */
+typedef struct
+{
+	uint32_t	ram_value;		/**<Live values */
+	uint32_t	ram_index;		/**<Address offsets, ID and NVM look-up tables */
+	uint32_t	ram_total;		/**<All RAM, including live values and index */
+	uint32_t	flash_table;	/**<Parameter table */
+	uint32_t	flash_total;	/**<All constant data, including parameter table */
+} par_mem_usage_t;
+
+/**
+ * 	Parameter change notification callback
+ *
+ * @param[in]	par_num	- Parameter number (enumeration) of changed parameter
+ * @param[in]	p_ctx	- Subscriber context given at subscription
+ */
+typedef void (*par_notify_cb_t)(const par_num_t par_num, void * const p_ctx);
+
+#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+
+	/**
+	 * 	Member of "par_type_t" for each data type token
+	 */
+	#define PAR_TYPE_MEMBER_U8						u8
+	#define PAR_TYPE_MEMBER_U16						u16
+	#define PAR_TYPE_MEMBER_U32						u32
+	#define PAR_TYPE_MEMBER_I8						i8
+	#define PAR_TYPE_MEMBER_I16						i16
+	#define PAR_TYPE_MEMBER_I32						i32
+	#define PAR_TYPE_MEMBER_F32						f32
+	#define PAR_TYPE_MEMBER_Q15						q15
+	#define PAR_TYPE_MEMBER_Q31						q31
+	#define PAR_TYPE_MEMBER_U64						u64
+	#define PAR_TYPE_MEMBER_I64						i64
+
+	/**
+	 * 	Optional columns of "PAR_CFG_TABLE" list
+	 *
+	 * @note	Row ends with description followed by optional length,
+	 * 			critical and policy (interval, delta, shutdown only)
+	 * 			columns. Missing column takes default value (single
+	 * 			value, not critical, zero policy), thus most rows end
+	 * 			with description. Each column requires columns before
+	 * 			it, policy columns are given all together.
+	 *
+	 * 			Columns are given as "..." of row, as description is
+	 * 			always present the list is never empty. It is first
+	 * 			filled up with defaults based on number of given
+	 * 			columns, then requested column is picked by position.
+	 */
+	#define PAR_CFG_COL_NUM_( _1, _2, _3, _4, _5, _6, n, ... )	n
+	#define PAR_CFG_COL_NUM( ... )					PAR_CFG_COL_NUM_( __VA_ARGS__, 6, 5, 4, 3, 2, 1, 0 )
+
+	#define PAR_CFG_COL_FILL_1( desc )				desc, 1U, false, 0UL, 0, false
+	#define PAR_CFG_COL_FILL_2( desc, len )			desc, len, false, 0UL, 0, false
+	#define PAR_CFG_COL_FILL_3( desc, len, crit )	desc, len, crit, 0UL, 0, false
+	#define PAR_CFG_COL_FILL_6( desc, len, crit, ival, delta, shdn )	desc, len, crit, ival, delta, shdn
+
+	#define PAR_CFG_COL_FILL__( n, ... )			PAR_CFG_COL_FILL_##n( __VA_ARGS__ )
+	#define PAR_CFG_COL_FILL_( n, ... )				PAR_CFG_COL_FILL__( n, __VA_ARGS__ )
+	#define PAR_CFG_COL_FILL( ... )					PAR_CFG_COL_FILL_( PAR_CFG_COL_NUM( __VA_ARGS__ ), __VA_ARGS__ )
+
+	#define PAR_CFG_COL_DESC_( desc, len, crit, ival, delta, shdn )		desc
+	#define PAR_CFG_COL_LEN_( desc, len, crit, ival, delta, shdn )		len
+	#define PAR_CFG_COL_CRIT_( desc, len, crit, ival, delta, shdn )		crit
+	#define PAR_CFG_COL_IVAL_( desc, len, crit, ival, delta, shdn )		ival
+	#define PAR_CFG_COL_DELTA_( desc, len, crit, ival, delta, shdn )	delta
+	#define PAR_CFG_COL_SHDN_( desc, len, crit, ival, delta, shdn )		shdn
+
+	#define PAR_CFG_COL_PICK( col, ... )			col( __VA_ARGS__ )
+	#define PAR_CFG_COL_DESC( ... )					PAR_CFG_COL_PICK( PAR_CFG_COL_DESC_, PAR_CFG_COL_FILL( __VA_ARGS__ ))
+	#define PAR_CFG_COL_LEN( ... )					PAR_CFG_COL_PICK( PAR_CFG_COL_LEN_, PAR_CFG_COL_FILL( __VA_ARGS__ ))
+	#define PAR_CFG_COL_CRIT( ... )					PAR_CFG_COL_PICK( PAR_CFG_COL_CRIT_, PAR_CFG_COL_FILL( __VA_ARGS__ ))
+	#define PAR_CFG_COL_IVAL( ... )					PAR_CFG_COL_PICK( PAR_CFG_COL_IVAL_, PAR_CFG_COL_FILL( __VA_ARGS__ ))
+	#define PAR_CFG_COL_DELTA( ... )				PAR_CFG_COL_PICK( PAR_CFG_COL_DELTA_, PAR_CFG_COL_FILL( __VA_ARGS__ ))
+	#define PAR_CFG_COL_SHDN( ... )					PAR_CFG_COL_PICK( PAR_CFG_COL_SHDN_, PAR_CFG_COL_FILL( __VA_ARGS__ ))
+
+	/**
+	 * 	Array length entry of parameter settings
+	 */
+	#if ( 1 == PAR_CFG_ARRAY_EN )
+		#define PAR_CFG_TABLE_LEN( ... )			.len = PAR_CFG_COL_LEN( __VA_ARGS__ ),
+	#else
+		#define PAR_CFG_TABLE_LEN( ... )
+	#endif
+
+	/**
+	 * 	Critical flag entry of parameter settings
+	 */
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		#define PAR_CFG_TABLE_CRIT( ... )			.critical = PAR_CFG_COL_CRIT( __VA_ARGS__ ),
+	#else
+		#define PAR_CFG_TABLE_CRIT( ... )
+	#endif
+
+	/**
+	 * 	Persistence policy entry of parameter settings
+	 *
+	 * @note	Delta is given in parameter data type.
+	 */
+	#if ( 1 == PAR_CFG_NVM_POLICY_EN )
+		#define PAR_CFG_TABLE_POLICY( type_, ... ) \
+			.policy = \
+			{ \
+				.interval_ms 					= PAR_CFG_COL_IVAL( __VA_ARGS__ ), \
+				.delta.PAR_TYPE_MEMBER_##type_	= PAR_CFG_COL_DELTA( __VA_ARGS__ ), \
+				.shutdown_only 					= PAR_CFG_COL_SHDN( __VA_ARGS__ ), \
+			},
+	#else
+		#define PAR_CFG_TABLE_POLICY( type_, ... )
+	#endif
+
+	/**
+	 * 	Parameter table entry generated from "PAR_CFG_TABLE" list
+	 *
+	 * @note	Used by par_cfg.c to build configuration table. Last
+	 * 			"..." holds description and optional columns.
+	 */
+	#define PAR_CFG_TABLE_ENTRY( num, id_, name_, min_, max_, def_, unit_, type_, access_, pers_, ... ) \
+		[num] = \
+		{ \
+			.id 							= ( id_ ), \
+			.name 							= ( name_ ), \
+			.min.PAR_TYPE_MEMBER_##type_	= ( min_ ), \
+			.max.PAR_TYPE_MEMBER_##type_	= ( max_ ), \
+			.def.PAR_TYPE_MEMBER_##type_	= ( def_ ), \
+			.unit 							= ( unit_ ), \
+			.type 							= ePAR_TYPE_##type_, \
+			.access 						= ( access_ ), \
+			.persistant 					= ( pers_ ), \
+			.desc 							= ( PAR_CFG_COL_DESC( __VA_ARGS__ )), \
+			PAR_CFG_TABLE_LEN( __VA_ARGS__ ) \
+			PAR_CFG_TABLE_CRIT( __VA_ARGS__ ) \
+			PAR_CFG_TABLE_POLICY( type_, __VA_ARGS__ ) \
+		},
+
+	/**
+	 * 	Parameter hot, default value and cold table entries generated
+	 * 	from "PAR_CFG_TABLE" list
+	 *
+	 * @note	Used by par_cfg.c to build separate tables when
+	 * 			"PAR_CFG_TABLE_SOA_EN" is enabled.
+	 */
+	#define PAR_CFG_TABLE_HOT_ENTRY( num, id_, name_, min_, max_, def_, unit_, type_, access_, pers_, ... ) \
+		[num] = \
+		{ \
+			.min.PAR_TYPE_MEMBER_##type_	= ( min_ ), \
+			.max.PAR_TYPE_MEMBER_##type_	= ( max_ ), \
+			.type 							= ePAR_TYPE_##type_, \
+			PAR_CFG_TABLE_LEN( __VA_ARGS__ ) \
+		},
+
+	#define PAR_CFG_TABLE_DEF_ENTRY( num, id_, name_, min_, max_, def_, unit_, type_, access_, pers_, ... ) \
+		[num] = { .PAR_TYPE_MEMBER_##type_ = ( def_ ) },
+
+	#define PAR_CFG_TABLE_COLD_ENTRY( num, id_, name_, min_, max_, def_, unit_, type_, access_, pers_, ... ) \
+		[num] = \
+		{ \
+			.id 							= ( id_ ), \
+			.name 							= ( name_ ), \
+			.unit 							= ( unit_ ), \
+			.access 						= ( access_ ), \
+			.persistant 					= ( pers_ ), \
+			.desc 							= ( PAR_CFG_COL_DESC( __VA_ARGS__ )), \
+			PAR_CFG_TABLE_CRIT( __VA_ARGS__ ) \
+			PAR_CFG_TABLE_POLICY( type_, __VA_ARGS__ ) \
+		},
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Parameter live values and its address offsets
+ *
+ * @note	Do not use directly, they are exposed only for typed getters!
+ */
+#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+	extern uint8_t * const			gpu8_par_value;
+	extern const par_addr_offset_t	g_par_addr_offset[ ePAR_NUM_OF ];
+#else
+	extern uint8_t * 				gpu8_par_value;
+	extern par_addr_offset_t 		g_par_addr_offset[ ePAR_NUM_OF ];
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions Prototypes
 ////////////////////////////////////////////////////////////////////////////////
@@ -145,27 +544,278 @@ par_status_t 	par_set					(const par_num_t par_num, const void * p_val);
 par_status_t	par_set_to_default		(const par_num_t par_num);
 par_status_t 	par_set_all_to_default	(void);
 par_status_t    par_has_changed         (const par_num_t par_num, bool *const p_has_changed);
+par_status_t 	par_set_batch			(const par_num_t * const p_par_num, const void * const * const pp_val, const uint32_t num);
 
 par_status_t 	par_get					(const par_num_t par_num, void * const p_val);
+par_status_t 	par_get_batch			(const par_num_t * const p_par_num, void * const * const pp_val, const uint32_t num);
+par_status_t 	par_get_isr				(const par_num_t par_num, void * const p_val);
+par_status_t 	par_set_isr				(const par_num_t par_num, const void * p_val);
+#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+	par_status_t	par_snapshot			(void * const p_buf, const uint32_t size, const par_addr_offset_t ** const pp_addr_offset);
+	par_status_t	par_get_snapshot_size	(uint32_t * const p_size);
+#endif
+#if ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+	par_status_t	par_get_change_seq		(uint32_t * const p_seq);
+	par_status_t	par_get_changes_since	(const uint32_t seq, par_num_t * const p_par_num, const uint32_t max, uint32_t * const p_num, uint32_t * const p_seq);
+#endif
 par_status_t	par_get_id				(const par_num_t par_num, uint16_t * const p_id);
 par_status_t	par_get_num_by_id		(const uint16_t id, par_num_t * const p_par_num);
 par_status_t 	par_get_config			(const par_num_t par_num, par_cfg_t * const p_par_cfg);
 par_status_t	par_get_type_size		(const par_type_list_t type, uint8_t * const p_size);
 par_status_t    par_get_type            (const par_num_t par_num, par_type_list_t *const p_type);
+par_status_t    par_get_len             (const par_num_t par_num, uint16_t *const p_len);
 par_status_t    par_get_range           (const par_num_t par_num, par_range_t *const p_range);
+par_status_t	par_get_mem_usage		(par_mem_usage_t * const p_usage);
 
 #if ( 1 == PAR_CFG_NVM_EN )
     par_status_t    par_set_n_save      (const par_num_t par_num, const void * p_val);
 	par_status_t	par_save_all		(void);
+	par_status_t	par_save_dirty		(void);
 	par_status_t	par_save			(const par_num_t par_num);
 	par_status_t	par_save_by_id		(const uint16_t par_id);
 	par_status_t	par_save_clean		(void);
+
+	#if ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+		par_status_t	par_hndl		(void);
+		par_status_t	par_flush		(void);
+	#endif
+
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		par_status_t	par_load_hndl		(void);
+		par_status_t	par_is_loaded		(const par_num_t par_num, bool * const p_is_loaded);
+	#endif
+#endif
+
+#if ( 1 == PAR_CFG_PROFILE_EN )
+	par_status_t	par_profile_capture		(const uint8_t profile);
+	par_status_t	par_profile_clear		(const uint8_t profile);
+	par_status_t	par_profile_activate	(const uint8_t profile);
+
+	#if ( 1 == PAR_CFG_NVM_EN )
+		par_status_t	par_profile_save	(const uint8_t profile);
+	#endif
+#endif
+
+#if ( 1 == PAR_CFG_NOTIFY_EN )
+	par_status_t	par_subscribe		(const par_num_t par_num, const par_notify_cb_t cb, void * const p_ctx);
+	par_status_t	par_unsubscribe		(const par_num_t par_num, const par_notify_cb_t cb, void * const p_ctx);
+	par_status_t	par_notify_hndl		(void);
+#endif
+
+#if ( 1 == PAR_CFG_STATS_EN )
+	par_status_t	par_get_stats		(par_stats_t * const p_stats);
+	par_status_t	par_clear_stats		(void);
+	void			par_print_stats		(void);
 #endif
 
 #if ( PAR_CFG_DEBUG_EN )
 	const char * par_get_status_str		(const par_status_t status);
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// Typed getters
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check declared type of parameter
+*
+* @note		Typed getters are intended for fast path (e.g. control loops),
+* 			therefore there is no data type dispatch and no mutex. Parameter
+* 			values of up to 32-bit are aligned to its size inside RAM, thus
+* 			read is a single load instruction that can not be torn by
+* 			concurrent "par_set()" on Cortex-M.
+*
+* 			There are no typed getters for 64-bit and array parameters
+* 			as their read can be torn, use "par_get()" instead.
+*
+* 			Parameter type is checked only when assertions are enabled.
+*
+* 			With "PAR_CFG_NVM_LAZY_EN" typed getters do not trigger
+* 			loading from NVM, thus they are unsafe for persistent parameter
+* 			until "par_is_loaded()" reports it loaded. Before that default
+* 			value is returned, which is caught by assertion.
+*
+* @pre		Parameters must be initialised before usage!
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @param[in]	type	- Expected data type of parameter
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void par_assert_type(const par_num_t par_num, const par_type_list_t type)
+{
+	#if ( 1 == PAR_CFG_ASSERT_EN )
+		par_type_list_t par_type = ePAR_TYPE_NUM_OF;
+
+		(void) par_get_type( par_num, &par_type );
+		PAR_ASSERT( type == par_type );
+
+		#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+			bool is_loaded = true;
+
+			(void) par_is_loaded( par_num, &is_loaded );
+			PAR_ASSERT( true == is_loaded );
+		#endif
+	#else
+		(void) par_num;
+		(void) type;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get unsigned 8-bit parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint8_t par_get_u8(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_U8 );
+
+	return *(const volatile uint8_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get signed 8-bit parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline int8_t par_get_i8(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_I8 );
+
+	return *(const volatile int8_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get unsigned 16-bit parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint16_t par_get_u16(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_U16 );
+
+	return *(const volatile uint16_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get signed 16-bit parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline int16_t par_get_i16(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_I16 );
+
+	return *(const volatile int16_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get unsigned 32-bit parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint32_t par_get_u32(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_U32 );
+
+	return *(const volatile uint32_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get signed 32-bit parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline int32_t par_get_i32(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_I32 );
+
+	return *(const volatile int32_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get floating value parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t par_get_f32(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_F32 );
+
+	return *(const volatile float32_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get Q15 fixed-point parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Raw Q15 value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline par_q15_t par_get_q15(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_Q15 );
+
+	return *(const volatile par_q15_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get Q31 fixed-point parameter
+*
+* @note		Lock-free, see "par_assert_type()" notes.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @return		value   - Raw Q31 value of parameter
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline par_q31_t par_get_q31(const par_num_t par_num)
+{
+	par_assert_type( par_num, ePAR_TYPE_Q31 );
+
+	return *(const volatile par_q31_t*) &gpu8_par_value[ g_par_addr_offset[par_num] ];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -35,6 +35,21 @@
 *			For details how parameters are handled in NVM go look at the
 *			documentation.
 *
+* @note		Data object is 4 bytes of header followed by "sizeof(par_type_t)"
+* 			bytes of data, thus "sizeof(par_nvm_data_obj_t)" is 8 bytes, or 12
+* 			bytes with "PAR_CFG_TYPE_64BIT_EN".
+*
+* @note		With "PAR_CFG_NVM_PACKED_EN" data object takes only parameter type
+* 			size of data, thus objects are 5 bytes up to "sizeof(par_nvm_data_obj_t)"
+* 			long and their address is calculated at init. Image format is told
+* 			by header signature.
+*
+* @note		With "PAR_CFG_NVM_JOURNAL_EN" data objects are not stored at fixed
+* 			address but appended to one of two journal sectors instead. At
+* 			init latest record of each parameter wins. When active sector is
+* 			full, live values are compacted into spare sector, which is then
+* 			committed by writing its header with next generation number.
+*
 * @note		RULES OF "PAR_CFG_TABLE_ID_CHECK_EN" SETTINGS:
 *
 * 			It is normal that parameter table will change during development
@@ -78,10 +93,24 @@
 
 	/**
 	 * 	Parameter signature and size in bytes
+	 *
+	 * 	@note	Signature also tells NVM image format version. Fixed
+	 * 			8-byte data objects or packed data objects, where data
+	 * 			size follows parameter type.
 	 */
 	#define PAR_NVM_SIGN							( 0xFF00AA55 )
+	#define PAR_NVM_SIGN_PACKED						( 0xFF00AA66 )
 	#define PAR_NVM_SIGN_SIZE						( 4UL )
 
+	/**
+	 * 	Signature of NVM image format in use
+	 */
+	#if ( 1 == PAR_CFG_NVM_PACKED_EN )
+		#define PAR_NVM_SIGN_ACT					( PAR_NVM_SIGN_PACKED )
+	#else
+		#define PAR_NVM_SIGN_ACT					( PAR_NVM_SIGN )
+	#endif
+
 	/**
 	 * 	Parameter header number of object size
 	 *
@@ -96,6 +125,19 @@
 	 */
 	#define PAR_NVM_CRC_SIZE						( 2UL )
 
+	/**
+	 * 	Parameter header generation size
+	 *
+	 * 	@note	Generation is stored only in A/B bank layout.
+	 *
+	 * 	Unit: byte
+	 */
+	#if ( 1 == PAR_CFG_NVM_AB_EN )
+		#define PAR_NVM_GEN_SIZE					( 4UL )
+	#else
+		#define PAR_NVM_GEN_SIZE					( 0UL )
+	#endif
+
 	/**
 	 * 	Parameter configuration hash size
 	 *
@@ -113,7 +155,8 @@
 	#define PAR_NVM_HEAD_SIGN_ADDR					( PAR_NVM_HEAD_ADDR )
 	#define PAR_NVM_HEAD_NB_OF_OBJ_ADDR				( PAR_NVM_HEAD_SIGN_ADDR 		+ PAR_NVM_SIGN_SIZE 		)
 	#define PAR_NVM_HEAD_CRC_ADDR					( PAR_NVM_HEAD_NB_OF_OBJ_ADDR 	+ PAR_NVM_NB_OF_OBJ_SIZE 	)
-	#define PAR_NVM_HEAD_HASH_ADDR					( PAR_NVM_HEAD_CRC_ADDR 		+ PAR_NVM_CRC_SIZE 			)
+	#define PAR_NVM_HEAD_GEN_ADDR					( PAR_NVM_HEAD_CRC_ADDR 		+ PAR_NVM_CRC_SIZE 			)
+	#define PAR_NVM_HEAD_HASH_ADDR					( PAR_NVM_HEAD_GEN_ADDR 		+ PAR_NVM_GEN_SIZE 			)
 
 	/**
 	 * 	Parameters first data object start address
@@ -122,6 +165,34 @@
 	 */
 	#define PAR_NVM_FIRST_DATA_OBJ_ADDR				( PAR_NVM_HEAD_HASH_ADDR + PAR_NVM_HASH_SIZE )
 
+	/**
+	 * 	Parameter NVM bank start address
+	 *
+	 * 	@note 	This is offset to reserved NVM region. All header and data
+	 * 			object addresses are relative to active bank.
+	 */
+	#if ( 1 == PAR_CFG_NVM_AB_EN )
+		#define PAR_NVM_BANK_NUM						( 2U )
+		#define PAR_NVM_BANK_ADDR( bank )				(( bank ) * PAR_CFG_NVM_AB_BANK_SIZE )
+		#define PAR_NVM_ACTIVE_BANK_ADDR				( PAR_NVM_BANK_ADDR( gu8_par_nvm_bank ))
+		#define PAR_NVM_AB_PENDING_WORD_NUM				(( ePAR_NUM_OF + 31U ) / 32U )
+	#else
+		#define PAR_NVM_ACTIVE_BANK_ADDR				( 0UL )
+	#endif
+
+	/**
+	 * 	Single bank NVM image addresses
+	 *
+	 * 	@note	Image stored without A/B banks starts at bank A address and
+	 * 			has no generation in header. Used only to carry such image
+	 * 			over into A/B banks at first init.
+	 */
+	#if ( 1 == PAR_CFG_NVM_AB_EN )
+		#define PAR_NVM_SINGLE_HEAD_SIZE				( PAR_NVM_SIGN_SIZE + PAR_NVM_NB_OF_OBJ_SIZE + PAR_NVM_CRC_SIZE )
+		#define PAR_NVM_SINGLE_HEAD_HASH_ADDR			( PAR_NVM_HEAD_ADDR + PAR_NVM_SINGLE_HEAD_SIZE )
+		#define PAR_NVM_SINGLE_FIRST_DATA_OBJ_ADDR		( PAR_NVM_SINGLE_HEAD_HASH_ADDR + PAR_NVM_HASH_SIZE )
+	#endif
+
 	/**
 	 * 	Parameter NVM header object
 	 */
@@ -130,1020 +201,3571 @@
 		uint32_t sign;		/**<Signature */
 		uint16_t obj_nb;	/**<Stored data object number */
 		uint16_t crc;		/**<Header CRC */
+
+		#if ( 1 == PAR_CFG_NVM_AB_EN )
+			uint32_t gen;	/**<Bank generation, incremented at each commit */
+		#endif
 	} par_nvm_head_obj_t;
 
 	/**
 	 * 	Parameter NVM data object
+	 *
+	 * 	@note	Data is kept as raw bytes so that it always directly follows
+	 * 			object head, regardless of "par_type_t" alignment (8 bytes
+	 * 			with "PAR_CFG_TYPE_64BIT_EN").
 	 */
 	typedef struct
 	{
-		uint16_t	id;		/**<Parameter ID */
-		uint8_t		size;	/**<Size of parameter data block */
-		uint8_t		crc;	/**<CRC of parameter value */
-		par_type_t 	data;	/**<4-byte storage for parameter value */
+		uint16_t	id;								/**<Parameter ID */
+		uint8_t		size;							/**<Size of parameter data block */
+		uint8_t		crc;							/**<CRC of parameter value */
+		uint8_t 	data[ sizeof( par_type_t ) ];	/**<Storage for parameter value */
 	} par_nvm_data_obj_t;
 
 	/**
-	 * 	Parameter NVM LUT talbe
+	 * 	Parameter NVM data object size without data
+	 *
+	 * 	@note	Data object takes that size plus "size" bytes of data
+	 * 			in NVM.
+	 *
+	 * 	Unit: byte
+	 */
+	#define PAR_NVM_DATA_OBJ_HEAD_SIZE				( 4UL )
+
+	/**
+	 * 	Parameter NVM LUT talbe entry
+	 *
+	 * 	@note	Indexed by parameter number (enumeration).
+	 *
+	 * 			With "PAR_CFG_COMPACT_EN" entry validity is told by its
+	 * 			address, as data object never starts at header address.
+	 */
+	#if ( 1 == PAR_CFG_COMPACT_EN )
+		typedef struct
+		{
+			uint16_t 	addr;	/**<Start address of parameter, 0 if not in LUT */
+		} par_nvm_lut_t;
+	#else
+		typedef struct
+		{
+			uint32_t 	addr;	/**<Start address of parameter */
+			bool		valid;	/**<Valid entry */
+		} par_nvm_lut_t;
+	#endif
+
+	/**
+	 * 	Address of each stored parameter shall fit into compact NVM LUT
+	 */
+	#if ( 1 == PAR_CFG_COMPACT_EN ) && ( 0 == PAR_CFG_NVM_JOURNAL_EN )
+		_Static_assert(( PAR_NVM_FIRST_DATA_OBJ_ADDR + ( ePAR_NUM_OF * sizeof( par_nvm_data_obj_t ))) <= ( UINT16_MAX + 1UL ), "Parameter settings invalid: NVM image does not fit compact NVM LUT (PAR_CFG_COMPACT_EN)!" );
+	#endif
+
+	/**
+	 * 	Parameter NVM load progress
 	 */
 	typedef struct
 	{
-		uint32_t 	addr;	/**<Start address of parameter */
-		uint16_t 	id;		/**<ID of stored parameter */
-		bool		valid;	/**<Valid entry */
-	} par_nvm_lut_t;
+		uint32_t	obj_addr;	/**<Address of next stored data object */
+		uint16_t	obj_num;	/**<Number of stored data objects */
+		uint16_t	obj_idx;	/**<Index of next stored data object */
+		bool		done;		/**<All stored data objects loaded */
+	} par_nvm_load_t;
 
-	////////////////////////////////////////////////////////////////////////////////
-	// Variables
-	////////////////////////////////////////////////////////////////////////////////
+	/**
+	 * 	Parameter number at given position of NVM image
+	 *
+	 * 	@note	With lazy loading critical parameters are placed first,
+	 * 			thus they are found in first chunks at init.
+	 */
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		#define PAR_NVM_OBJ_ORDER( pos )				((par_num_t) gu16_par_nvm_obj_order[( pos )])
+	#else
+		#define PAR_NVM_OBJ_ORDER( pos )				((par_num_t)( pos ))
+	#endif
 
-    /**
-     *      Initialization guard
-     */
-     static bool gb_is_init = false;
+	/**
+	 * 	Number of data objects in NVM load buffer
+	 */
+	#define PAR_NVM_LOAD_BUF_OBJ_NUM				( PAR_CFG_NVM_LOAD_BUF_SIZE / sizeof( par_nvm_data_obj_t ))
 
 	/**
-	 * 	Parameter NVM lut
+	 * 	Load buffer must hold at least one data object
 	 */
-	static par_nvm_lut_t g_par_nvm_data_obj_addr[ePAR_NUM_OF] = {0};
+	_Static_assert( PAR_NVM_LOAD_BUF_OBJ_NUM > 0, "Parameter settings invalid: PAR_CFG_NVM_LOAD_BUF_SIZE too small!" );
 
-	////////////////////////////////////////////////////////////////////////////////
-	// Function Prototypes
-	////////////////////////////////////////////////////////////////////////////////
-	static par_status_t		par_nvm_load_all					(const uint16_t num_of_par);
+	#if ( 1 == PAR_CFG_NVM_JOURNAL_EN )
 
-	static par_status_t		par_nvm_corrupt_signature			(void);
-	static par_status_t 	par_nvm_read_header					(par_nvm_head_obj_t * const p_head_obj);
-	static par_status_t 	par_nvm_write_header				(const uint16_t num_of_par);
-	static par_status_t 	par_nvm_validate_header				(uint16_t * const p_num_of_par);
+		/**
+		 * 	Journal sector signature
+		 */
+		#define PAR_NVM_JRNL_SIGN					( 0xFF00AA5A )
 
-	static uint16_t 		par_nvm_calc_crc					(const uint8_t * const p_data, const uint8_t size);
-	static uint8_t 			par_nvm_calc_obj_crc				(const par_nvm_data_obj_t * const p_obj);
-	static uint16_t			par_nvm_get_per_par					(void);
+		/**
+		 * 	Number of journal sectors
+		 *
+		 * 	@note	One is active, other one is spare for compaction.
+		 */
+		#define PAR_NVM_JRNL_SECTOR_NUM				( 2U )
 
-	static void 	par_nvm_build_new_nvm_lut					(void);
-	static uint16_t par_nvm_get_nvm_lut_addr					(const uint16_t id);
-	static bool		par_nvm_is_in_nvm_lut						(const uint16_t id );
+		/**
+		 * 	Journal sector start address
+		 *
+		 * 	@note 	This is offset to reserved NVM region.
+		 */
+		#define PAR_NVM_JRNL_SECTOR_ADDR( sector )	(( sector ) * PAR_CFG_NVM_JOURNAL_SECTOR_SIZE )
 
-	#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
-		static par_status_t	par_nvm_erase_signature	(void);
-		static par_status_t par_nvm_check_table_id	(const uint8_t * const p_table_id);
-		static par_status_t par_nvm_write_table_id	(const uint8_t * const p_table_id);
-	#endif
+		/**
+		 * 	Reserved parameter ID
+		 *
+		 * 	@note	Erased flash reads as 0xFF, thus parameter with that ID
+		 * 			could not be distinguished from free journal space.
+		 */
+		#define PAR_NVM_JRNL_ERASED_ID				( 0xFFFFU )
 
-    static par_status_t par_nvm_init_nvm    (void);
-    static par_status_t par_nvm_sync        (void);
+		/**
+		 * 	Journal sector header
+		 *
+		 * 	@note	Written as last after compaction, thus sector with valid
+		 * 			header always holds complete set of parameters.
+		 */
+		typedef struct
+		{
+			uint32_t sign;		/**<Signature */
+			uint16_t gen;		/**<Sector generation, incremented at each compaction */
+			uint16_t crc;		/**<Header CRC */
+		} par_nvm_jrnl_head_t;
 
-	////////////////////////////////////////////////////////////////////////////////
-	// Functions
-	////////////////////////////////////////////////////////////////////////////////
+		/**
+		 * 	Journal sector must be filled with whole records
+		 */
+		_Static_assert( 0 == ( PAR_CFG_NVM_JOURNAL_SECTOR_SIZE % sizeof( par_nvm_data_obj_t )), "Parameter settings invalid: PAR_CFG_NVM_JOURNAL_SECTOR_SIZE must be multiple of 8!" );
+		_Static_assert( sizeof( par_nvm_jrnl_head_t ) == sizeof( par_nvm_data_obj_t ), "Journal header must take one record slot!" );
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Initialize parameter NVM handling
-	*
-	* @brief 	Based on settings in "par_cfg.h" initialisation phase is done.
-	* 			Settings such as "PAR_CFG_TABLE_ID_CHECK_EN" will affect checking
-	* 			for table ID.
-	*
-	* @return	status - Status of initialisation
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_nvm_init(void)
-	{
-		par_status_t 	status 		= ePAR_OK;
-		uint16_t 		obj_nb		= 0;
-		uint16_t		per_par_nb	= 0;
-        
-        // Init NVM module
-        status = par_nvm_init_nvm();
+	#endif
 
-        // NVM driver init OK
-        if ( ePAR_OK == status )
-        {
-            // Par NVM module init
-            gb_is_init = true;
-
-    		// Get number of persistent parameters
-    		per_par_nb = par_nvm_get_per_par();
-
-    		// At least one persistent parameter
-    		if ( per_par_nb > 0 )
-    		{
-    			// Validate header
-    			status = par_nvm_validate_header( &obj_nb );
-
-    			// NVM header OK
-    			if ( ePAR_OK == status )
-    			{
-    				// Check hash
-    				#if ( PAR_CFG_TABLE_ID_CHECK_EN )
-    					// TODO: ...
-    				#endif
-
-    				// Load all parameters
-    				status = par_nvm_load_all( obj_nb );
-
-    				// Load CRC error
-    				if ( ePAR_ERROR_CRC == status )
-    				{
-    					status = par_nvm_reset_all();
-
-    					status |= ePAR_WARN_SET_TO_DEF;
-    					status |= ePAR_WARN_NVM_REWRITTEN;
-    				}
-
-    				// NVM error
-    				else if ( ePAR_ERROR_NVM == status )
-    				{
-    					/**
-    					 * 	@note	Set all parameters to default as it might happend
-    					 *			that some of the parameters will be loaded from
-    					 *			NVM and some will have default values.
-    					 *
-    					 *			System might behave unexpectedly if having some
-    					 *			default and some modified parameter values!
-    					 */
-    					par_set_all_to_default();
-
-    					status |= ePAR_WARN_SET_TO_DEF;
-    				}
-    				else
-    				{
-    					// No actions...
-    				}
-    			}
-
-    			// 		Signature NOT OK
-    			// OR	Header CRC corrupted
-    			else if (	( ePAR_ERROR == status )
-    					||	( ePAR_ERROR_CRC == status ))
-    			{
-    				status = par_nvm_reset_all();
-
-    				status |= ePAR_WARN_SET_TO_DEF;
-    				status |= ePAR_WARN_NVM_REWRITTEN;
-    			}
-
-    			// NVM Error
-    			else
-    			{
-    				// No actions...
-    			}
-    		}
-
-    		// No persistent parameters
-    		else
-    		{
-    			status |= ePAR_WARN_NO_PERSISTANT;
-    			PAR_DBG_PRINT( "PAR_NVM: No persistent parameters... Nothing to do..." );
-    		}
-        }
+	#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
 
-		return status;
-	}
+		/**
+		 * 	Parameter table ID size
+		 *
+		 * 	@note	Stored inside header hash area.
+		 *
+		 * 	Unit: byte
+		 */
+		#if ( 1 == PAR_CFG_TABLE_ID_COMPACT_EN )
+			#define PAR_NVM_TABLE_ID_SIZE			( 4UL )
+		#else
+			#define PAR_NVM_TABLE_ID_SIZE			( PAR_NVM_HASH_SIZE )
+		#endif
 
-    ////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		De-Initialize parameter NVM handling
-	*
-	* @return	status - Status of de-init
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-    par_status_t par_nvm_deinit(void)
-    {
-        par_status_t status = ePAR_OK;
-        
-        if ( true == gb_is_init )
-        {
-            if ( eNVM_OK != nvm_deinit())
-            {
-                status = ePAR_ERROR;
-            }
-        }
-        else
-        {
-            status = ePAR_ERROR;
-        }
+		#define PAR_NVM_TABLE_ID_WORD_NUM			( PAR_NVM_TABLE_ID_SIZE / sizeof( uint32_t ))
 
-        return status;
-    }
+		/**
+		 * 	Parameter table ID hash
+		 *
+		 * 	@note	Only fields that affect NVM layout are hashed: ID, data
+		 * 			type and persistence. Each parameter is mixed separately
+		 * 			(Murmur3 finalizer) and summed, thus result does not depend
+		 * 			on order of parameters inside table. Each word of table ID
+		 * 			is calculated with different seed.
+		 *
+		 * 			Written as constant expression so that table ID can
+		 * 			be calculated by compiler. Result is truncated to 32-bit
+		 * 			after each step in order to get the same result on all
+		 * 			targets.
+		 */
+		#define PAR_NVM_TABLE_ID_KEY( id, type, pers )		((uint32_t)((((uint32_t)( id )) << 8U ) | (((uint32_t)( type )) << 1U ) | ((uint32_t)( pers ))))
+		#define PAR_NVM_TABLE_ID_SEED( seed )				((uint32_t)(( seed ) * 0x9E3779B9UL ))
+
+		#define PAR_NVM_TABLE_ID_XSH( h, sh )				((uint32_t)(( h ) ^ (( h ) >> ( sh ))))
+		#define PAR_NVM_TABLE_ID_MUL( h, k )				((uint32_t)(( h ) * ( k )))
+		#define PAR_NVM_TABLE_ID_FMIX( h )					PAR_NVM_TABLE_ID_XSH( PAR_NVM_TABLE_ID_MUL( PAR_NVM_TABLE_ID_XSH( PAR_NVM_TABLE_ID_MUL( PAR_NVM_TABLE_ID_XSH( h, 16U ), 0x85EBCA6BUL ), 13U ), 0xC2B2AE35UL ), 16U )
+
+		#define PAR_NVM_TABLE_ID_MIX( seed, id, type, pers )	PAR_NVM_TABLE_ID_FMIX( PAR_NVM_TABLE_ID_KEY( id, type, pers ) ^ PAR_NVM_TABLE_ID_SEED( seed ))
+
+		#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+
+			/**
+			 * 	Parameter table ID calculated from "PAR_CFG_TABLE" list
+			 */
+			#define PAR_NVM_TABLE_ID_ROW_0( num, id, name, min, max, def, unit, type, access, pers, ... )		+ PAR_NVM_TABLE_ID_MIX( 0UL, id, ePAR_TYPE_##type, pers )
+			#define PAR_NVM_TABLE_ID_ROW_1( num, id, name, min, max, def, unit, type, access, pers, ... )		+ PAR_NVM_TABLE_ID_MIX( 1UL, id, ePAR_TYPE_##type, pers )
+			#define PAR_NVM_TABLE_ID_ROW_2( num, id, name, min, max, def, unit, type, access, pers, ... )		+ PAR_NVM_TABLE_ID_MIX( 2UL, id, ePAR_TYPE_##type, pers )
+			#define PAR_NVM_TABLE_ID_ROW_3( num, id, name, min, max, def, unit, type, access, pers, ... )		+ PAR_NVM_TABLE_ID_MIX( 3UL, id, ePAR_TYPE_##type, pers )
+			#define PAR_NVM_TABLE_ID_ROW_4( num, id, name, min, max, def, unit, type, access, pers, ... )		+ PAR_NVM_TABLE_ID_MIX( 4UL, id, ePAR_TYPE_##type, pers )
+			#define PAR_NVM_TABLE_ID_ROW_5( num, id, name, min, max, def, unit, type, access, pers, ... )		+ PAR_NVM_TABLE_ID_MIX( 5UL, id, ePAR_TYPE_##type, pers )
+			#define PAR_NVM_TABLE_ID_ROW_6( num, id, name, min, max, def, unit, type, access, pers, ... )		+ PAR_NVM_TABLE_ID_MIX( 6UL, id, ePAR_TYPE_##type, pers )
+			#define PAR_NVM_TABLE_ID_ROW_7( num, id, name, min, max, def, unit, type, access, pers, ... )		+ PAR_NVM_TABLE_ID_MIX( 7UL, id, ePAR_TYPE_##type, pers )
+
+			#define PAR_NVM_TABLE_ID_WORD( n )				((uint32_t)( 0UL PAR_CFG_TABLE( PAR_NVM_TABLE_ID_ROW_##n )))
+		#endif
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Store parameter value to NVM
-    *
-    * @note     Sync has only effect when using EEPROM emulated NVM feature! When 
-    *           using Flash end memory device.
-    *
-    * @note     In case of using Flash end memory for storing parameters take special
-    *           care when enabling sync (nvm_sync=true). At each sync data from RAM
-    *           is copied to FLASH.
-	*
-	* @param[in]	par_num     - Parameter enumeration number
-	* @param[in]	nvm_sync    - Perform NVM sync after parameter write
-	* @return		status      - Status of operation
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_nvm_write(const par_num_t par_num, const bool nvm_sync)
-	{
-		par_status_t 		status 		= ePAR_OK;
-		par_nvm_data_obj_t	obj_data	= { 0 };
-		uint32_t			par_addr	= 0UL;
-		par_cfg_t			par_cfg		= {0};
+		/**
+		 * 	Table ID must fit into header hash area
+		 */
+		_Static_assert( PAR_NVM_TABLE_ID_SIZE <= PAR_NVM_HASH_SIZE, "Table ID does not fit into NVM header!" );
+
+	#endif
+
+	#if ( 1 == PAR_CFG_PROFILE_EN )
 
-		PAR_ASSERT( true == gb_is_init );     
-		PAR_ASSERT( par_num < ePAR_NUM_OF );
+		/**
+		 * 	Parameter profile signature
+		 */
+		#define PAR_NVM_PROFILE_SIGN				( 0xFF00AA70 )
 
-		if ( true == gb_is_init )
+		/**
+		 * 	Parameter profile slot header
+		 */
+		typedef struct
 		{
-            if ( par_num < ePAR_NUM_OF )
-            {
-    			// Get configuration
-    			par_get_config( par_num, &par_cfg );
-
-    			// Is that parameter persistent
-    			if ( true == par_cfg.persistant )
-    			{
-    				// Get current par value
-    				par_get( par_num, (uint32_t*) &obj_data.data );
-
-    				// Get parameter ID
-    				obj_data.id = par_cfg.id;
-
-    				// Get parameter type size
-    				// NOTE: For know fixed!
-    				//par_get_type_size( par_cfg.type, &obj_data.size );
-    				obj_data.size = 4;
-
-    				// Calculate CRC
-    				obj_data.crc = par_nvm_calc_obj_crc( &obj_data );
-
-    				// Get address from NVM lut
-    				//par_addr = g_par_nvm_data_obj_addr[par_num].addr;
-    				par_addr = par_nvm_get_nvm_lut_addr( obj_data.id );
-
-    				// Write to NVM
-    				if ( eNVM_OK != nvm_write( PAR_CFG_NVM_REGION, par_addr, sizeof( par_nvm_data_obj_t ), (const uint8_t*) &obj_data ))
-    				{
-    					status |= ePAR_ERROR_NVM;
-    				}
-
-                    // Sync NVM
-                    if ( true == nvm_sync )
-                    {
-                        status |= par_nvm_sync();
-                    }
-    			}
-    			else
-    			{
-    				status = ePAR_ERROR;
-    			}
-    		}
-    		else
-    		{
-    			status = ePAR_ERROR;
-    		}
-        }
-        else
-        {
-            status = ePAR_ERROR_INIT;
-        }
+			uint32_t sign;		/**<Signature */
+			uint16_t num;		/**<Number of stored entries */
+			uint16_t crc;		/**<Header CRC */
+		} par_nvm_profile_head_t;
 
-		return status;
-	}
+		/**
+		 * 	Parameter profile slot address
+		 *
+		 * 	@note 	This is offset to reserved NVM region. Each slot holds
+		 * 			header and all profile entries as data objects.
+		 */
+		#define PAR_NVM_PROFILE_SLOT_SIZE			( sizeof( par_nvm_profile_head_t ) + ( PAR_CFG_PROFILE_ENTRY_NUM * sizeof( par_nvm_data_obj_t )))
+		#define PAR_NVM_PROFILE_SLOT_ADDR( profile )	( PAR_CFG_NVM_PROFILE_ADDR + (( profile ) * PAR_NVM_PROFILE_SLOT_SIZE ))
+
+		/**
+		 * 	Profile slots shall not overlap with parameters storage
+		 *
+		 * @note	Fixed slot image is checked for one object of each
+		 * 			parameter, as written by "par_nvm_reset_all()". Image
+		 * 			might still grow by objects of removed parameters and
+		 * 			objects of other size, thus appending new objects is
+		 * 			bounded at runtime by "par_nvm_load_new()".
+		 */
+		#if ( 1 == PAR_CFG_NVM_JOURNAL_EN )
+			_Static_assert( PAR_CFG_NVM_PROFILE_ADDR >= ( 2UL * PAR_CFG_NVM_JOURNAL_SECTOR_SIZE ), "Parameter settings invalid: Profiles (PAR_CFG_NVM_PROFILE_ADDR) overlap with journal sectors!" );
+		#elif ( 1 == PAR_CFG_NVM_AB_EN )
+			_Static_assert( PAR_CFG_NVM_PROFILE_ADDR >= ( PAR_NVM_BANK_NUM * PAR_CFG_NVM_AB_BANK_SIZE ), "Parameter settings invalid: Profiles (PAR_CFG_NVM_PROFILE_ADDR) overlap with A/B banks!" );
+		#else
+			_Static_assert( PAR_CFG_NVM_PROFILE_ADDR >= ( PAR_NVM_FIRST_DATA_OBJ_ADDR + ( ePAR_NUM_OF * sizeof( par_nvm_data_obj_t ))), "Parameter settings invalid: Profiles (PAR_CFG_NVM_PROFILE_ADDR) overlap with NVM image!" );
+		#endif
+
+	#endif
 
 	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Store all parameter value to NVM
-	*
-	* @return		status 	- Status of operation
-	*/
+	// Variables
 	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_nvm_write_all(void)
-	{
-		par_status_t 	status 		= ePAR_OK;
-		uint16_t		par_num		= 0;
-		par_cfg_t		par_cfg		= { 0 };
 
-        PAR_ASSERT( true == gb_is_init );     
+    /**
+     *      Initialization guard
+     */
+     static bool gb_is_init = false;
 
-		if ( true == gb_is_init )
-        {
-    		// Corrupt header (enter critical)
-    		status |= par_nvm_corrupt_signature();
-
-            // Got thru all parameters
-    		for ( par_num = 0UL; par_num < ePAR_NUM_OF; par_num++ )
-    		{   
-                // Get parameter configuration
-    			par_get_config( par_num, &par_cfg );
-                
-                // Store only persistant one
-    			if ( true == par_cfg.persistant )
-    			{   
-                    // Sync will be done later
-    				status |= par_nvm_write( par_num, false );
-    			}
-    		}
-
-            // Re-write header (exit critical)
-    		status |= par_nvm_write_header( par_nvm_get_per_par());
-
-            // Sync NVM
-            status |= par_nvm_sync();
-
-    		PAR_DBG_PRINT( "PAR_NVM: Storing all to NVM status: %s", par_get_status_str(status) );
-        }
-        else
-        {
-            status = ePAR_ERROR_INIT;
-        }
+	#if ( 0 == PAR_CFG_NVM_JOURNAL_EN )
 
-		return status;
-	}
+		/**
+		 * 	Parameter NVM lut
+		 *
+		 * 	@note	Indexed by parameter number (enumeration).
+		 */
+		static par_nvm_lut_t g_par_nvm_data_obj_addr[ePAR_NUM_OF] = {0};
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Reset total section of parameters NVM
-	*
-	* @brief	This function completely re-write whole NVM section.
-	*
-	* 			It first corrupt signature in order to raise "working in progress"
-	* 			flag.
-	*
-	* @return	num_of_per_par - Number of persistent parameters
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_nvm_reset_all(void)
-	{
-		par_status_t status = ePAR_OK;
+		/**
+		 * 	Number of data objects in NVM image
+		 *
+		 * 	@note	Might be larger than number of persistent parameters, as
+		 * 			objects of removed parameters and older objects of other
+		 * 			size are kept until image is re-written.
+		 */
+		static uint16_t gu16_par_nvm_obj_nb = 0U;
+
+		#if ( 1 == PAR_CFG_NVM_AB_EN )
+
+			/**
+			 * 	Active bank and its generation
+			 */
+			static uint8_t	gu8_par_nvm_bank 	= 0U;
+			static uint32_t	gu32_par_nvm_gen	= 0UL;
+
+			/**
+			 * 	Parameters written since last bank commit
+			 *
+			 * 	@note	Commit is done at next "par_nvm_sync()". Only
+			 * 			these take live value, rest are copied from
+			 * 			active bank.
+			 */
+			static uint32_t gu32_par_nvm_ab_pending[ PAR_NVM_AB_PENDING_WORD_NUM ] = { 0 };
 
-        PAR_ASSERT( true == gb_is_init );     
+		#endif
 
-		if ( true == gb_is_init )
-        {
-    		// Build new NVM lut
-    		par_nvm_build_new_nvm_lut();
+		#if ( 1 == PAR_CFG_NVM_LAZY_EN )
 
-    		// Write all data object
-    		status |= par_nvm_write_all();
+			/**
+			 * 	Lazy load progress
+			 *
+			 * 	@note	Protected by "par_if_aquire_nvm_mutex()" after init.
+			 */
+			static par_nvm_load_t g_par_nvm_load = { 0 };
 
-    		// Re-write header as reseting whole NVM parameter memory
-    		
-            // ZIGA: Redundant TODO: 
-            //status |= par_nvm_write_header( par_nvm_get_per_par() );
+			/**
+			 * 	Order of parameters inside NVM image and number of
+			 * 	critical persistent parameters at its start
+			 */
+			static uint16_t gu16_par_nvm_obj_order[ePAR_NUM_OF] = { 0 };
+			static uint16_t gu16_par_nvm_crit_num = 0U;
 
-            // Sync NVM
+		#endif
 
-            // ZIGA: Redundant TODO: 
-            //status |= par_nvm_sync();
-        }
-        else
-        {
-            status = ePAR_ERROR_INIT;
-        }
+		#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
+
+			/**
+			 * 	Parameter table ID
+			 *
+			 * 	@note	With static layout calculated at compile time,
+			 * 			otherwise once at init from configuration table.
+			 */
+			#if ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+				#if ( 1 == PAR_CFG_TABLE_ID_COMPACT_EN )
+					static const uint32_t gu32_par_nvm_table_id[PAR_NVM_TABLE_ID_WORD_NUM] = { PAR_NVM_TABLE_ID_WORD( 0 ) };
+				#else
+					static const uint32_t gu32_par_nvm_table_id[PAR_NVM_TABLE_ID_WORD_NUM] =
+					{
+						PAR_NVM_TABLE_ID_WORD( 0 ), PAR_NVM_TABLE_ID_WORD( 1 ), PAR_NVM_TABLE_ID_WORD( 2 ), PAR_NVM_TABLE_ID_WORD( 3 ),
+						PAR_NVM_TABLE_ID_WORD( 4 ), PAR_NVM_TABLE_ID_WORD( 5 ), PAR_NVM_TABLE_ID_WORD( 6 ), PAR_NVM_TABLE_ID_WORD( 7 ),
+					};
+				#endif
+			#else
+				static uint32_t gu32_par_nvm_table_id[PAR_NVM_TABLE_ID_WORD_NUM] = { 0 };
+			#endif
 
-		return status;
-	}
+		#endif
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Print parameter NVM table
-	*
-	* @note		Only for debugging purposes
-	*
-	* @return	void
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	par_status_t par_nvm_print_nvm_lut(void)
-	{
-        par_status_t status = ePAR_OK;
+	#else
+
+		/**
+		 * 	Active journal sector, its generation and offset of first
+		 * 	free record slot inside sector
+		 */
+		static uint8_t	gu8_par_nvm_jrnl_sector 	= 0U;
+		static uint16_t	gu16_par_nvm_jrnl_gen 		= 0U;
+		static uint32_t	gu32_par_nvm_jrnl_wr_offset	= 0UL;
 
-		#if ( PAR_CFG_DEBUG_EN )
-			uint16_t par_num = 0;
+	#endif
 
-			PAR_DBG_PRINT( "PAR_NVM: Parameter NVM look-up table:" );
-			PAR_DBG_PRINT( " %s\t%s\t%s\t\t%s", "#", "ID", "Addr", "Valid" );
-			PAR_DBG_PRINT( "===============================" );
+	#if ( 0 == PAR_CFG_NVM_CRC_HW_EN )
+		#if ( 256 == PAR_CFG_NVM_CRC_TABLE_SIZE )
 
-			for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+			/**
+			 * 	CRC-16-CCITT (poly 0x1021) look-up table, one byte per step
+			 */
+			static const uint16_t gu16_par_nvm_crc_table[256] =
 			{
-				PAR_DBG_PRINT( " %d\t%d\t0x%04X\t%d", par_num, 	g_par_nvm_data_obj_addr[par_num].id,
-																g_par_nvm_data_obj_addr[par_num].addr,
-																g_par_nvm_data_obj_addr[par_num].valid );
-				PAR_DBG_PRINT( "-----------------------------" );
-			}
-		#endif
+				0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+				0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+				0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+				0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+				0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+				0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+				0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+				0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+				0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+				0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+				0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+				0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+				0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+				0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+				0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+				0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+				0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+				0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+				0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+				0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+				0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+				0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+				0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+				0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+				0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+				0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+				0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+				0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+				0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+				0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+				0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+				0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+			};
+
+		#elif ( 16 == PAR_CFG_NVM_CRC_TABLE_SIZE )
+
+			/**
+			 * 	CRC-16-CCITT (poly 0x1021) look-up table, one nibble per step
+			 */
+			static const uint16_t gu16_par_nvm_crc_table[16] =
+			{
+				0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+				0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+			};
 
-        return status;
-	}
+		#endif
+	#endif
 
-	////////////////////////////////////////////////////////////////////////////////
 	/**
-	* @} <!-- END GROUP -->
-	*/
-	////////////////////////////////////////////////////////////////////////////////
+	 * 	NVM load buffer
+	 */
+	static par_nvm_data_obj_t g_par_nvm_load_buf[PAR_NVM_LOAD_BUF_OBJ_NUM] = {0};
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*@addtogroup KERNEL_PAR_NVM_FUNCTIONS
-	* @{ <!-- BEGIN GROUP -->
-	*
-	* 	Kernel functions of device parameters NVM handling
-	*/
-	////////////////////////////////////////////////////////////////////////////////
+	#if ( 1 == PAR_CFG_STATS_EN )
+
+		/**
+		 * 	NVM access statistics
+		 */
+		static par_stats_nvm_t g_par_nvm_stats = { 0 };
+
+	#endif
 
 	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Corrupt parameter signature to NVM
-	*
-	* @brief	Return ePAR_OK if signature corrupted OK. In case of NVM error it returns
-	* 			ePAR_ERROR_NVM.
-	*
-	* @return		status 	- Status of operation
-	*/
+	// Function Prototypes
 	////////////////////////////////////////////////////////////////////////////////
-	static par_status_t	par_nvm_corrupt_signature(void)
-	{
-		par_status_t status = ePAR_OK;
+	static uint16_t 		par_nvm_calc_crc					(const uint8_t * const p_data, const uint8_t size);
+	static uint8_t 			par_nvm_calc_obj_crc				(const par_nvm_data_obj_t * const p_obj);
+	static bool				par_nvm_check_obj					(const par_nvm_data_obj_t * const p_obj);
+	static void				par_nvm_make_obj					(const par_num_t par_num, par_nvm_data_obj_t * const p_obj);
+	static uint8_t			par_nvm_get_data_size				(const par_num_t par_num);
+	static uint16_t			par_nvm_get_per_par					(void);
 
-		if ( eNVM_OK != nvm_erase( PAR_CFG_NVM_REGION, PAR_NVM_HEAD_SIGN_ADDR, PAR_NVM_SIGN_SIZE ))
-		{
-			status = ePAR_ERROR_NVM;
-			PAR_DBG_PRINT( "PAR_NVM: NVM error during signature corruption!" );
-		}
+	static nvm_status_t		par_nvm_io_read						(const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+	static nvm_status_t		par_nvm_io_write					(const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+	static nvm_status_t		par_nvm_io_erase					(const uint32_t addr, const uint32_t size);
+	static nvm_status_t		par_nvm_io_sync						(void);
 
-		return status;
-	}
+    static par_status_t par_nvm_init_nvm    (void);
 
-	#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
+	#if ( 0 == PAR_CFG_NVM_JOURNAL_EN )
+		static par_status_t		par_nvm_load_all					(const uint16_t num_of_par);
+		static par_status_t		par_nvm_load_chunk					(par_nvm_load_t * const p_load);
+		static par_status_t		par_nvm_load_new					(const uint16_t num_of_par, uint32_t obj_addr);
+		static par_status_t		par_nvm_load_obj					(const par_nvm_data_obj_t * const p_obj, const uint32_t obj_addr);
+
+		#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+			static par_status_t	par_nvm_load_start					(const par_nvm_head_obj_t * const p_head_obj);
+			static par_status_t	par_nvm_load_next					(void);
+			static par_status_t	par_nvm_load_until					(const par_num_t par_num);
+			static par_status_t	par_nvm_load_fault					(const par_status_t load_status);
+			static bool			par_nvm_is_critical_loaded			(void);
+			static void			par_nvm_build_obj_order				(void);
+		#endif
+
+		static par_status_t		par_nvm_corrupt_signature			(void);
+		static par_status_t 	par_nvm_read_header					(par_nvm_head_obj_t * const p_head_obj);
+		static par_status_t 	par_nvm_write_header				(const uint16_t num_of_par);
+		static par_status_t 	par_nvm_validate_header				(par_nvm_head_obj_t * const p_head_obj);
+		static uint16_t			par_nvm_calc_head_crc				(const par_nvm_head_obj_t * const p_head_obj);
+
+		static void 	par_nvm_build_new_nvm_lut					(void);
+		static par_status_t par_nvm_get_nvm_lut_addr				(const par_num_t par_num, uint32_t * const p_addr);
+		static bool		par_nvm_is_in_nvm_lut						(const par_num_t par_num);
+		static void		par_nvm_lut_set								(const par_num_t par_num, const uint32_t addr);
+		static void		par_nvm_lut_clear							(const par_num_t par_num);
+
+		#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
+			static par_status_t par_nvm_check_table_id	(const uint32_t addr);
+			static par_status_t par_nvm_write_table_id	(void);
+
+			#if ( 0 == PAR_CFG_STATIC_LAYOUT_EN )
+				static void		par_nvm_calc_table_id	(void);
+			#endif
+		#endif
+
+		#if ( 1 == PAR_CFG_NVM_AB_EN )
+			static par_status_t par_nvm_ab_select_bank	(par_nvm_head_obj_t * const p_head_obj);
+			static par_status_t par_nvm_ab_migrate		(const par_status_t bank_status, par_nvm_head_obj_t * const p_head_obj);
+			static par_status_t par_nvm_ab_commit		(void);
+			static par_status_t par_nvm_ab_write_chunk	(const uint32_t obj_addr, const uint32_t size);
+			static bool			par_nvm_ab_is_pending	(void);
+		#endif
+	#else
+		static par_status_t	par_nvm_jrnl_check_table	(const uint16_t per_par_nb);
+		static par_status_t par_nvm_jrnl_find_active	(void);
+		static par_status_t par_nvm_jrnl_load			(void);
+		static par_status_t par_nvm_jrnl_append			(const par_nvm_data_obj_t * const p_obj);
+		static par_status_t par_nvm_jrnl_compact		(void);
+		static uint16_t		par_nvm_jrnl_calc_head_crc	(const par_nvm_jrnl_head_t * const p_head);
+		static bool			par_nvm_jrnl_is_erased		(const par_nvm_data_obj_t * const p_obj);
+	#endif
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Functions
+	////////////////////////////////////////////////////////////////////////////////
+
+	#if ( 0 == PAR_CFG_NVM_JOURNAL_EN )
 
 		////////////////////////////////////////////////////////////////////////////////
 		/**
-		*		Erase parameter signature from NVM
+		*		Initialize parameter NVM handling
 		*
-		* @return		status 	- Status of operation
+		* @brief 	Based on settings in "par_cfg.h" initialisation phase is done.
+		* 			Settings such as "PAR_CFG_TABLE_ID_CHECK_EN" will affect checking
+		* 			for table ID.
+		*
+		* @return	status - Status of initialisation
 		*/
 		////////////////////////////////////////////////////////////////////////////////
-		static par_status_t	par_nvm_erase_signature(void)
+		par_status_t par_nvm_init(void)
 		{
-			par_status_t status = ePAR_OK;
+			par_status_t 		status 		= ePAR_OK;
+			par_nvm_head_obj_t	head_obj	= {0};
+			uint16_t			per_par_nb	= 0;
 
-			status = nvm_erase( PAR_CFG_NVM_REGION, PAR_NVM_SIGNATURE_ADDR_OFFSET, 4U );
+			#if ( 1 == PAR_CFG_NVM_AB_EN )
+				bool			is_migrated	= false;
+			#endif
 
-			return status;
-		}
+			// Critical parameters first, nothing to load until header is validated
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				par_nvm_build_obj_order();
+				g_par_nvm_load.done = true;
+			#endif
 
-		////////////////////////////////////////////////////////////////////////////////
+	        // Init NVM module
+	        status = par_nvm_init_nvm();
+
+	        // NVM driver init OK
+	        if ( ePAR_OK == status )
+	        {
+	            // Par NVM module init
+	            gb_is_init = true;
+
+	    		// Get number of persistent parameters
+	    		per_par_nb = par_nvm_get_per_par();
+
+	    		// Calculate table ID
+	    		#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN ) && ( 0 == PAR_CFG_STATIC_LAYOUT_EN )
+	    			par_nvm_calc_table_id();
+	    		#endif
+
+	    		// At least one persistent parameter
+	    		if ( per_par_nb > 0 )
+	    		{
+	    			// Validate header
+	    			#if ( 1 == PAR_CFG_NVM_AB_EN )
+	    				status = par_nvm_ab_select_bank( &head_obj );
+
+	    				// No valid bank, carry over image stored without A/B banks
+	    				if 	(	( ePAR_ERROR == status )
+	    					||	( ePAR_ERROR_CRC == status ))
+	    				{
+	    					status = par_nvm_ab_migrate( status, &head_obj );
+	    					is_migrated = ( ePAR_OK == status );
+	    				}
+	    			#else
+	    				status = par_nvm_validate_header( &head_obj );
+	    			#endif
+
+	    			// NVM header OK
+	    			if ( ePAR_OK == status )
+	    			{
+	    				gu16_par_nvm_obj_nb = head_obj.obj_nb;
+
+	    				// Load critical or all parameters
+	    				#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+	    					status = par_nvm_load_start( &head_obj );
+	    				#else
+	    					status = par_nvm_load_all( head_obj.obj_nb );
+	    				#endif
+
+	    				// Single bank image carried over into A/B banks
+	    				#if ( 1 == PAR_CFG_NVM_AB_EN )
+	    					if (( ePAR_OK == status ) && ( true == is_migrated ))
+	    					{
+	    						status |= ePAR_WARN_NVM_REWRITTEN;
+	    					}
+	    				#endif
+
+	    				// Migrate fixed object format image to packed one
+	    				#if ( 1 == PAR_CFG_NVM_PACKED_EN )
+	    					if (( ePAR_OK == status ) && ( PAR_NVM_SIGN_ACT != head_obj.sign ))
+	    					{
+	    						status = par_nvm_reset_all();
+
+	    						status |= ePAR_WARN_NVM_REWRITTEN;
+	    						PAR_DBG_PRINT( "PAR_NVM: NVM image migrated to packed format!" );
+	    					}
+	    				#endif
+
+	    				// Load CRC error
+	    				if ( ePAR_ERROR_CRC == status )
+	    				{
+	    					status = par_nvm_reset_all();
+
+	    					status |= ePAR_WARN_SET_TO_DEF;
+	    					status |= ePAR_WARN_NVM_REWRITTEN;
+	    				}
+
+	    				// NVM error
+	    				else if ( ePAR_ERROR_NVM == status )
+	    				{
+	    					/**
+	    					 * 	@note	Set all parameters to default as it might happend
+	    					 *			that some of the parameters will be loaded from
+	    					 *			NVM and some will have default values.
+	    					 *
+	    					 *			System might behave unexpectedly if having some
+	    					 *			default and some modified parameter values!
+	    					 */
+	    					par_set_all_to_default();
+
+	    					status |= ePAR_WARN_SET_TO_DEF;
+	    				}
+	    				else
+	    				{
+	    					// No actions...
+	    				}
+	    			}
+
+	    			// 		Signature NOT OK
+	    			// OR	Header CRC corrupted
+	    			else if (	( ePAR_ERROR == status )
+	    					||	( ePAR_ERROR_CRC == status ))
+	    			{
+	    				status = par_nvm_reset_all();
+
+	    				status |= ePAR_WARN_SET_TO_DEF;
+	    				status |= ePAR_WARN_NVM_REWRITTEN;
+	    			}
+
+	    			// NVM Error
+	    			else
+	    			{
+	    				// No actions...
+	    			}
+	    		}
+
+	    		// No persistent parameters
+	    		else
+	    		{
+	    			status |= ePAR_WARN_NO_PERSISTANT;
+	    			PAR_DBG_PRINT( "PAR_NVM: No persistent parameters... Nothing to do..." );
+	    		}
+	        }
+
+			// Nothing left for background loading
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				if ( true == g_par_nvm_load.done )
+				{
+					par_set_loaded_all();
+				}
+			#endif
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Store parameter value to NVM
+	    *
+	    * @note     Sync has only effect when using EEPROM emulated NVM feature! When 
+	    *           using Flash end memory device.
+	    *
+	    * @note     In case of using Flash end memory for storing parameters take special
+	    *           care when enabling sync (nvm_sync=true). At each sync data from RAM
+	    *           is copied to FLASH.
+		*
+		* @param[in]	par_num     - Parameter enumeration number
+		* @param[in]	nvm_sync    - Perform NVM sync after parameter write
+		* @return		status      - Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_write(const par_num_t par_num, const bool nvm_sync)
+		{
+			par_status_t 		status 		= ePAR_OK;
+			par_cfg_t			par_cfg		= {0};
+
+			#if ( 0 == PAR_CFG_NVM_AB_EN )
+				par_nvm_data_obj_t	obj_data	= { 0 };
+				uint32_t			par_addr	= 0UL;
+			#endif
+
+			PAR_ASSERT( true == gb_is_init );     
+			PAR_ASSERT( par_num < ePAR_NUM_OF );
+
+			if ( true == gb_is_init )
+			{
+	            if ( par_num < ePAR_NUM_OF )
+	            {
+	    			// Get configuration
+	    			par_get_config( par_num, &par_cfg );
+
+	    			// Is that parameter persistent
+	    			if ( true == par_cfg.persistant )
+	    			{
+	    				#if ( 1 == PAR_CFG_NVM_AB_EN )
+
+	    					// Live value is stored at next bank commit
+	    					gu32_par_nvm_ab_pending[ par_num / 32U ] |= ( 1UL << ( par_num % 32U ));
+
+	    					// Commit bank
+	    					if ( true == nvm_sync )
+	    					{
+	    						status = par_nvm_sync();
+	    					}
+
+	    				#else
+
+		    				// Address is known once stored object is found
+		    				#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		    					if (( false == g_par_nvm_load.done ) && ( false == par_nvm_is_in_nvm_lut( par_num )))
+		    					{
+		    						(void) par_nvm_load_until( ePAR_NUM_OF );
+		    					}
+		    				#endif
+
+		    				// Create data object
+		    				par_nvm_make_obj( par_num, &obj_data );
+
+		    				// Get address from NVM lut
+		    				status = par_nvm_get_nvm_lut_addr( par_num, &par_addr );
+
+		    				// Write to NVM
+		    				if ( ePAR_OK == status )
+		    				{
+			    				if ( eNVM_OK != par_nvm_io_write( par_addr, ( PAR_NVM_DATA_OBJ_HEAD_SIZE + obj_data.size ), (const uint8_t*) &obj_data ))
+			    				{
+			    					status |= ePAR_ERROR_NVM;
+			    				}
+
+			                    // Sync NVM
+			                    if ( true == nvm_sync )
+			                    {
+			                        status |= par_nvm_sync();
+			                    }
+		    				}
+
+	    				#endif
+	    			}
+	    			else
+	    			{
+	    				status = ePAR_ERROR;
+	    			}
+	    		}
+	    		else
+	    		{
+	    			status = ePAR_ERROR;
+	    		}
+	        }
+	        else
+	        {
+	            status = ePAR_ERROR_INIT;
+	        }
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Store all parameter value to NVM
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_write_all(void)
+		{
+			par_status_t 	status 		= ePAR_OK;
+
+			#if ( 0 == PAR_CFG_NVM_AB_EN )
+				uint16_t		par_num		= 0;
+				par_cfg_t		par_cfg		= { 0 };
+			#endif
+
+	        PAR_ASSERT( true == gb_is_init );     
+
+			if ( true == gb_is_init )
+	        {
+	        	// Stored values of not loaded parameters would be lost
+	        	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+	        		if ( false == g_par_nvm_load.done )
+	        		{
+	        			status = par_nvm_load_until( ePAR_NUM_OF );
+	        		}
+	        	#endif
+
+	        	#if ( 1 == PAR_CFG_NVM_AB_EN )
+
+	        		// Write all live values to inactive bank and commit
+	        		memset( gu32_par_nvm_ab_pending, 0xFF, sizeof( gu32_par_nvm_ab_pending ));
+	        		status |= par_nvm_ab_commit();
+
+	        	#else
+
+		    		// Corrupt header (enter critical)
+		    		status |= par_nvm_corrupt_signature();
+
+		            // Got thru all parameters
+		    		for ( par_num = 0UL; par_num < ePAR_NUM_OF; par_num++ )
+		    		{   
+		                // Get parameter configuration
+		    			par_get_config( par_num, &par_cfg );
+	                
+		                // Store only persistant one
+		    			if ( true == par_cfg.persistant )
+		    			{   
+		                    // Sync will be done later
+		    				status |= par_nvm_write( par_num, false );
+		    			}
+		    		}
+
+		            // Re-write header (exit critical), objects after persistent ones stay in image
+		    		status |= par_nvm_write_header( gu16_par_nvm_obj_nb );
+
+		            // Sync NVM
+		            status |= par_nvm_sync();
+
+	            #endif
+
+	    		PAR_DBG_PRINT( "PAR_NVM: Storing all to NVM status: %s", par_get_status_str(status) );
+	        }
+	        else
+	        {
+	            status = ePAR_ERROR_INIT;
+	        }
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Reset total section of parameters NVM
+		*
+		* @brief	This function completely re-write whole NVM section.
+		*
+		* 			It first corrupt signature in order to raise "working in progress"
+		* 			flag.
+		*
+		* @return	num_of_per_par - Number of persistent parameters
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_reset_all(void)
+		{
+			par_status_t status = ePAR_OK;
+
+	        PAR_ASSERT( true == gb_is_init );     
+
+			if ( true == gb_is_init )
+	        {
+	        	// Stored values of not loaded parameters would be lost
+	        	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+	        		if ( false == g_par_nvm_load.done )
+	        		{
+	        			status = par_nvm_load_until( ePAR_NUM_OF );
+	        		}
+	        	#endif
+
+	    		// Build new NVM lut
+	    		par_nvm_build_new_nvm_lut();
+
+	    		// Write all data object
+	    		status |= par_nvm_write_all();
+
+	    		// Re-write header as reseting whole NVM parameter memory
+    		
+	            // ZIGA: Redundant TODO: 
+	            //status |= par_nvm_write_header( par_nvm_get_per_par() );
+
+	            // Sync NVM
+
+	            // ZIGA: Redundant TODO: 
+	            //status |= par_nvm_sync();
+	        }
+	        else
+	        {
+	            status = ePAR_ERROR_INIT;
+	        }
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Print parameter NVM table
+		*
+		* @note		Only for debugging purposes
+		*
+		* @return	void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_print_nvm_lut(void)
+		{
+	        par_status_t status = ePAR_OK;
+
+			#if ( PAR_CFG_DEBUG_EN )
+				uint16_t par_num = 0;
+				uint16_t par_id	 = 0;
+
+				PAR_DBG_PRINT( "PAR_NVM: Parameter NVM look-up table:" );
+				PAR_DBG_PRINT( " %s\t%s\t%s\t\t%s", "#", "ID", "Addr", "Valid" );
+				PAR_DBG_PRINT( "===============================" );
+
+				for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+				{
+					(void) par_get_id( par_num, &par_id );
+
+					PAR_DBG_PRINT( " %d\t%d\t0x%04X\t%d", par_num, 	par_id,
+																	g_par_nvm_data_obj_addr[par_num].addr,
+																	par_nvm_is_in_nvm_lut( par_num ));
+					PAR_DBG_PRINT( "-----------------------------" );
+				}
+			#endif
+
+	        return status;
+		}
+
+		#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Load next chunk of parameters from NVM in background
+			*
+			* @note		Once all stored parameters are loaded function has no
+			* 			effect.
+			*
+			* @return		status 	- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			par_status_t par_nvm_load_hndl(void)
+			{
+				par_status_t status = ePAR_OK;
+
+				PAR_ASSERT( true == gb_is_init );
+
+				if ( true == gb_is_init )
+				{
+					if ( false == g_par_nvm_load.done )
+					{
+						#if ( 1 == PAR_CFG_MUTEX_EN )
+							if ( ePAR_OK == par_if_aquire_nvm_mutex())
+							{
+						#endif
+								// Might be finished by other task meanwhile
+								if ( false == g_par_nvm_load.done )
+								{
+									status = par_nvm_load_fault( par_nvm_load_next());
+								}
+
+						#if ( 1 == PAR_CFG_MUTEX_EN )
+								par_if_release_nvm_mutex();
+							}
+
+							// Mutex not acquire
+							else
+							{
+								status = ePAR_ERROR;
+							}
+						#endif
+					}
+				}
+				else
+				{
+					status = ePAR_ERROR_INIT;
+				}
+
+				return status;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Load parameter from NVM on demand
+			*
+			* @note		Stored objects are loaded in order of NVM image until
+			* 			requested parameter is found, thus call might take
+			* 			multiple NVM reads.
+			*
+			* @param[in]	par_num	- Parameter number (enumeration)
+			* @return		status 	- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			par_status_t par_nvm_load(const par_num_t par_num)
+			{
+				par_status_t status = ePAR_OK;
+
+				PAR_ASSERT( par_num < ePAR_NUM_OF );
+
+				if ( true != gb_is_init )
+				{
+					status = ePAR_ERROR_INIT;
+				}
+				else if ( par_num >= ePAR_NUM_OF )
+				{
+					status = ePAR_ERROR;
+				}
+				else if ( false == g_par_nvm_load.done )
+				{
+					status = par_nvm_load_until( par_num );
+				}
+				else
+				{
+					// No actions...
+				}
+
+				return status;
+			}
+
+		#endif // 1 == PAR_CFG_NVM_LAZY_EN
+
+	#else
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Initialize parameter NVM handling
+		*
+		* @brief 	Journal sector with valid header and newest generation is
+		* 			selected as active. All records from it are then applied in
+		* 			order of writing, thus latest record of parameter wins.
+		*
+		* 			In case no valid sector is found, journal is re-created
+		* 			with default values.
+		*
+		* @return	status - Status of initialisation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_init(void)
+		{
+			par_status_t 	status 		= ePAR_OK;
+			uint16_t		per_par_nb	= 0;
+
+			// Init NVM module
+			status = par_nvm_init_nvm();
+
+			// NVM driver init OK
+			if ( ePAR_OK == status )
+			{
+				// Par NVM module init
+				gb_is_init = true;
+
+				// Get number of persistent parameters
+				per_par_nb = par_nvm_get_per_par();
+
+				// At least one persistent parameter
+				if ( per_par_nb > 0 )
+				{
+					// Check that parameter table fits into journal
+					status = par_nvm_jrnl_check_table( per_par_nb );
+
+					if ( ePAR_OK == status )
+					{
+						// Find active sector
+						status = par_nvm_jrnl_find_active();
+
+						// Active sector found
+						if ( ePAR_OK == status )
+						{
+							// Replay journal
+							status = par_nvm_jrnl_load();
+						}
+
+						// No valid sector
+						else if ( ePAR_ERROR == status )
+						{
+							status = par_nvm_reset_all();
+
+							status |= ePAR_WARN_SET_TO_DEF;
+							status |= ePAR_WARN_NVM_REWRITTEN;
+						}
+						else
+						{
+							// No actions...
+						}
+
+						// NVM error
+						if ( ePAR_ERROR_NVM & status )
+						{
+							/**
+							 * 	@note	Set all parameters to default as it might happend
+							 *			that some of the parameters will be loaded from
+							 *			NVM and some will have default values.
+							 */
+							par_set_all_to_default();
+
+							status |= ePAR_WARN_SET_TO_DEF;
+						}
+					}
+				}
+
+				// No persistent parameters
+				else
+				{
+					status |= ePAR_WARN_NO_PERSISTANT;
+					PAR_DBG_PRINT( "PAR_NVM: No persistent parameters... Nothing to do..." );
+				}
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Store parameter value to NVM
+		*
+		* @brief	New record is appended to active journal sector. When sector
+		* 			is full it is compacted into spare sector, where live values
+		* 			of all persistent parameters are written, including that one.
+		*
+		* @param[in]	par_num     - Parameter enumeration number
+		* @param[in]	nvm_sync    - Perform NVM sync after parameter write
+		* @return		status      - Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_write(const par_num_t par_num, const bool nvm_sync)
+		{
+			par_status_t 		status 		= ePAR_OK;
+			par_nvm_data_obj_t	obj_data	= { 0 };
+			par_cfg_t			par_cfg		= {0};
+
+			PAR_ASSERT( true == gb_is_init );
+			PAR_ASSERT( par_num < ePAR_NUM_OF );
+
+			if ( true == gb_is_init )
+			{
+				if ( par_num < ePAR_NUM_OF )
+				{
+					// Get configuration
+					par_get_config( par_num, &par_cfg );
+
+					// Is that parameter persistent
+					if ( true == par_cfg.persistant )
+					{
+						// Create data object
+						par_nvm_make_obj( par_num, &obj_data );
+
+						// Append to journal
+						status = par_nvm_jrnl_append( &obj_data );
+
+						// Sector full
+						if ( ePAR_ERROR == status )
+						{
+							status = par_nvm_jrnl_compact();
+						}
+
+						// Sync NVM
+						if ( true == nvm_sync )
+						{
+							status |= par_nvm_sync();
+						}
+					}
+					else
+					{
+						status = ePAR_ERROR;
+					}
+				}
+				else
+				{
+					status = ePAR_ERROR;
+				}
+			}
+			else
+			{
+				status = ePAR_ERROR_INIT;
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Store all parameter value to NVM
+		*
+		* @note		If there is no space for all records in active sector,
+		* 			compaction is done instead of appending.
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_write_all(void)
+		{
+			par_status_t 	status 		= ePAR_OK;
+			uint16_t		par_num		= 0;
+			par_cfg_t		par_cfg		= { 0 };
+
+			PAR_ASSERT( true == gb_is_init );
+
+			if ( true == gb_is_init )
+			{
+				// Enough space for all persistent parameters
+				if (( gu32_par_nvm_jrnl_wr_offset + ( par_nvm_get_per_par() * sizeof( par_nvm_data_obj_t ))) <= PAR_CFG_NVM_JOURNAL_SECTOR_SIZE )
+				{
+					for ( par_num = 0UL; par_num < ePAR_NUM_OF; par_num++ )
+					{
+						// Get parameter configuration
+						par_get_config( par_num, &par_cfg );
+
+						// Store only persistant one
+						if ( true == par_cfg.persistant )
+						{
+							// Sync will be done later
+							status |= par_nvm_write( par_num, false );
+						}
+					}
+
+					// Sync NVM
+					status |= par_nvm_sync();
+				}
+				else
+				{
+					status = par_nvm_jrnl_compact();
+				}
+
+				PAR_DBG_PRINT( "PAR_NVM: Storing all to NVM status: %s", par_get_status_str(status) );
+			}
+			else
+			{
+				status = ePAR_ERROR_INIT;
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Reset total section of parameters NVM
+		*
+		* @brief	Journal is compacted into spare sector, thus all previous
+		* 			records are discarded and only live values are kept.
+		*
+		* @return	status - Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_reset_all(void)
+		{
+			par_status_t status = ePAR_OK;
+
+			PAR_ASSERT( true == gb_is_init );
+
+			if ( true == gb_is_init )
+			{
+				status = par_nvm_jrnl_compact();
+			}
+			else
+			{
+				status = ePAR_ERROR_INIT;
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Print parameter NVM journal status
+		*
+		* @note		Only for debugging purposes
+		*
+		* @return	void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_print_nvm_lut(void)
+		{
+			par_status_t status = ePAR_OK;
+
+			#if ( PAR_CFG_DEBUG_EN )
+				PAR_DBG_PRINT( "PAR_NVM: Parameter NVM journal:" );
+				PAR_DBG_PRINT( " Active sector: %d", gu8_par_nvm_jrnl_sector );
+				PAR_DBG_PRINT( " Generation: %d", gu16_par_nvm_jrnl_gen );
+				PAR_DBG_PRINT( " Used: %d/%d bytes", gu32_par_nvm_jrnl_wr_offset, PAR_CFG_NVM_JOURNAL_SECTOR_SIZE );
+			#endif
+
+			return status;
+		}
+
+	#endif // 0 == PAR_CFG_NVM_JOURNAL_EN
+
+    ////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		De-Initialize parameter NVM handling
+	*
+	* @return	status - Status of de-init
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+    par_status_t par_nvm_deinit(void)
+    {
+        par_status_t status = ePAR_OK;
+        
+        if ( true == gb_is_init )
+        {
+            if ( eNVM_OK != nvm_deinit())
+            {
+                status = ePAR_ERROR;
+            }
+        }
+        else
+        {
+            status = ePAR_ERROR;
+        }
+
+        return status;
+    }
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Sync NVM module
+	*
+	* @note		Use after "par_nvm_write()" calls with disabled sync.
+	*
+	* 			With "PAR_CFG_NVM_AB_EN" pending changes are committed to
+	* 			inactive bank here.
+	*
+	* @return		status - Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_nvm_sync(void)
+	{
+		par_status_t status = ePAR_OK;
+
+		#if ( 1 == PAR_CFG_NVM_AB_EN )
+
+			// Commit syncs NVM by itself
+			if ( true == par_nvm_ab_is_pending())
+			{
+				status = par_nvm_ab_commit();
+			}
+			else
+
+		#endif
+
+		if ( eNVM_OK != par_nvm_io_sync())
+		{
+			status = ePAR_ERROR_NVM;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Add memory usage of NVM module
+	*
+	* @note		Sizes are added to ones already filled by "par_get_mem_usage()".
+	*
+	* @param[in,out]	p_usage	- Pointer to memory usage
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	void par_nvm_get_mem_usage(par_mem_usage_t * const p_usage)
+	{
+		uint32_t ram 	= ( sizeof( gb_is_init ) + sizeof( g_par_nvm_load_buf ));
+		uint32_t flash 	= 0UL;
+
+		PAR_ASSERT( NULL != p_usage );
+
+		#if ( 0 == PAR_CFG_NVM_JOURNAL_EN )
+			p_usage->ram_index += sizeof( g_par_nvm_data_obj_addr );
+			ram += ( sizeof( g_par_nvm_data_obj_addr ) + sizeof( gu16_par_nvm_obj_nb ));
+
+			#if ( 1 == PAR_CFG_NVM_AB_EN )
+				ram += ( sizeof( gu8_par_nvm_bank ) + sizeof( gu32_par_nvm_gen ) + sizeof( gu32_par_nvm_ab_pending ));
+			#endif
+
+			#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+				ram += ( sizeof( g_par_nvm_load ) + sizeof( gu16_par_nvm_obj_order ) + sizeof( gu16_par_nvm_crit_num ));
+			#endif
+
+			#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN ) && ( 1 == PAR_CFG_STATIC_LAYOUT_EN )
+				flash += sizeof( gu32_par_nvm_table_id );
+			#elif ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
+				ram += sizeof( gu32_par_nvm_table_id );
+			#endif
+		#else
+			ram += ( sizeof( gu8_par_nvm_jrnl_sector ) + sizeof( gu16_par_nvm_jrnl_gen ) + sizeof( gu32_par_nvm_jrnl_wr_offset ));
+		#endif
+
+		#if ( 0 == PAR_CFG_NVM_CRC_HW_EN ) && ( 0 != PAR_CFG_NVM_CRC_TABLE_SIZE )
+			flash += sizeof( gu16_par_nvm_crc_table );
+		#endif
+
+		#if ( 1 == PAR_CFG_STATS_EN )
+			ram += sizeof( g_par_nvm_stats );
+		#endif
+
+		p_usage->ram_total 		+= ram;
+		p_usage->flash_total 	+= flash;
+	}
+
+	#if ( 1 == PAR_CFG_STATS_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Get NVM access statistics
+		*
+		* @param[out]	p_stats	- Pointer to NVM statistics
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		void par_nvm_get_stats(par_stats_nvm_t * const p_stats)
+		{
+			PAR_ASSERT( NULL != p_stats );
+
+			*p_stats = g_par_nvm_stats;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Clear NVM access statistics
+		*
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		void par_nvm_clear_stats(void)
+		{
+			memset( &g_par_nvm_stats, 0, sizeof( g_par_nvm_stats ));
+		}
+
+	#endif
+
+	#if ( 1 == PAR_CFG_PROFILE_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Write parameter profile to NVM
+		*
+		* @brief	Profile is stored as a unit into its own slot. Slot header is
+		* 			invalidated first and written back as last, thus power loss
+		* 			leaves slot empty instead of mixed one.
+		*
+		* @param[in]	profile		- Profile number
+		* @param[in]	p_profile	- Pointer to profile
+		* @return		status 		- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_profile_write(const uint8_t profile, const par_profile_t * const p_profile)
+		{
+			par_status_t 			status 		= ePAR_OK;
+			par_nvm_profile_head_t	head		= { 0 };
+			uint32_t				obj_addr	= PAR_NVM_PROFILE_SLOT_ADDR( profile ) + sizeof( par_nvm_profile_head_t );
+			uint32_t				buf_num		= 0UL;
+
+			PAR_ASSERT( true == gb_is_init );
+			PAR_ASSERT( profile < PAR_CFG_PROFILE_NUM );
+			PAR_ASSERT( NULL != p_profile );
+
+			if ( true != gb_is_init )
+			{
+				status = ePAR_ERROR_INIT;
+			}
+			else if (( profile >= PAR_CFG_PROFILE_NUM ) || ( NULL == p_profile ))
+			{
+				status = ePAR_ERROR;
+			}
+			else
+			{
+				// Invalidate slot (enter critical)
+				head.sign = 0UL;
+
+				if ( eNVM_OK != par_nvm_io_write( PAR_NVM_PROFILE_SLOT_ADDR( profile ), sizeof( par_nvm_profile_head_t ), (const uint8_t*) &head ))
+				{
+					status = ePAR_ERROR_NVM;
+				}
+
+				// Write entries in chunks of load buffer
+				for ( uint32_t i = 0; ( i < p_profile->num ) && ( ePAR_OK == status ); i++ )
+				{
+					memcpy( g_par_nvm_load_buf[buf_num].data, &p_profile->entry[i].val, sizeof( par_type_t ));
+					g_par_nvm_load_buf[buf_num].size = par_nvm_get_data_size( p_profile->entry[i].par_num );
+					(void) par_get_id( p_profile->entry[i].par_num, &g_par_nvm_load_buf[buf_num].id );
+					g_par_nvm_load_buf[buf_num].crc = par_nvm_calc_obj_crc( &g_par_nvm_load_buf[buf_num] );
+					buf_num++;
+
+					if 	(	( PAR_NVM_LOAD_BUF_OBJ_NUM == buf_num )
+						||	(( i + 1UL ) == p_profile->num ))
+					{
+						if ( eNVM_OK != par_nvm_io_write( obj_addr, ( buf_num * sizeof( par_nvm_data_obj_t )), (const uint8_t*) &g_par_nvm_load_buf ))
+						{
+							status = ePAR_ERROR_NVM;
+						}
+
+						obj_addr += ( buf_num * sizeof( par_nvm_data_obj_t ));
+						buf_num = 0UL;
+					}
+				}
+
+				// Write header (exit critical)
+				if ( ePAR_OK == status )
+				{
+					head.sign 	= PAR_NVM_PROFILE_SIGN;
+					head.num 	= p_profile->num;
+					head.crc 	= par_nvm_calc_crc((const uint8_t*) &head.num, sizeof( head.num ));
+
+					if ( eNVM_OK != par_nvm_io_write( PAR_NVM_PROFILE_SLOT_ADDR( profile ), sizeof( par_nvm_profile_head_t ), (const uint8_t*) &head ))
+					{
+						status = ePAR_ERROR_NVM;
+					}
+				}
+
+				if ( ePAR_OK == status )
+				{
+					if ( eNVM_OK != par_nvm_io_sync())
+					{
+						status = ePAR_ERROR_NVM;
+					}
+				}
+
+				PAR_DBG_PRINT( "PAR_NVM: Profile %d write with status: %s", profile, par_get_status_str(status));
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Read parameter profile from NVM
+		*
+		* @note		Entries of parameters no longer in table, with corrupted
+		* 			CRC or with data size not matching parameter type are
+		* 			dropped. Entries are ordered by parameter number.
+		*
+		* @param[in]	profile		- Profile number
+		* @param[out]	p_profile	- Pointer to profile
+		* @return		status 		- Status of operation, ePAR_ERROR if slot is empty
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		par_status_t par_nvm_profile_read(const uint8_t profile, par_profile_t * const p_profile)
+		{
+			par_status_t 			status 		= ePAR_OK;
+			par_nvm_profile_head_t	head		= { 0 };
+			uint32_t				obj_addr	= PAR_NVM_PROFILE_SLOT_ADDR( profile ) + sizeof( par_nvm_profile_head_t );
+			uint32_t				obj_num		= 0UL;
+			uint32_t				buf_num		= 0UL;
+			uint32_t				j			= 0UL;
+			par_num_t				par_num		= 0;
+
+			PAR_ASSERT( true == gb_is_init );
+			PAR_ASSERT( profile < PAR_CFG_PROFILE_NUM );
+			PAR_ASSERT( NULL != p_profile );
+
+			if ( true != gb_is_init )
+			{
+				status = ePAR_ERROR_INIT;
+			}
+			else if (( profile >= PAR_CFG_PROFILE_NUM ) || ( NULL == p_profile ))
+			{
+				status = ePAR_ERROR;
+			}
+			else
+			{
+				p_profile->num = 0U;
+
+				if ( eNVM_OK != par_nvm_io_read( PAR_NVM_PROFILE_SLOT_ADDR( profile ), sizeof( par_nvm_profile_head_t ), (uint8_t*) &head ))
+				{
+					status = ePAR_ERROR_NVM;
+				}
+
+				// Empty or corrupted slot
+				else if (	( PAR_NVM_PROFILE_SIGN != head.sign )
+						||	( par_nvm_calc_crc((const uint8_t*) &head.num, sizeof( head.num )) != head.crc )
+						||	( head.num > PAR_CFG_PROFILE_ENTRY_NUM ))
+				{
+					status = ePAR_ERROR;
+				}
+				else
+				{
+					obj_num = head.num;
+				}
+
+				// Read entries in chunks of load buffer
+				while (( obj_num > 0UL ) && ( ePAR_OK == status ))
+				{
+					buf_num = ( obj_num < PAR_NVM_LOAD_BUF_OBJ_NUM ) ? obj_num : PAR_NVM_LOAD_BUF_OBJ_NUM;
+
+					if ( eNVM_OK != par_nvm_io_read( obj_addr, ( buf_num * sizeof( par_nvm_data_obj_t )), (uint8_t*) &g_par_nvm_load_buf ))
+					{
+						status = ePAR_ERROR_NVM;
+						break;
+					}
+
+					for ( uint32_t i = 0; i < buf_num; i++ )
+					{
+						if 	(	( true == par_nvm_check_obj( &g_par_nvm_load_buf[i] ))
+							&&	( ePAR_OK == par_get_num_by_id( g_par_nvm_load_buf[i].id, &par_num ))
+							&&	( par_nvm_get_data_size( par_num ) == g_par_nvm_load_buf[i].size ))
+						{
+							// Insert ordered by parameter number
+							for ( j = p_profile->num; ( j > 0UL ) && ( p_profile->entry[ j - 1UL ].par_num > par_num ); j-- )
+							{
+								p_profile->entry[j] = p_profile->entry[ j - 1UL ];
+							}
+
+							p_profile->entry[j].par_num = par_num;
+							memset( &p_profile->entry[j].val, 0, sizeof( par_type_t ));
+							memcpy( &p_profile->entry[j].val, g_par_nvm_load_buf[i].data, g_par_nvm_load_buf[i].size );
+							p_profile->num++;
+						}
+					}
+
+					obj_addr += ( buf_num * sizeof( par_nvm_data_obj_t ));
+					obj_num -= buf_num;
+				}
+			}
+
+			return status;
+		}
+
+	#endif // 1 == PAR_CFG_PROFILE_EN
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	* @} <!-- END GROUP -->
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*@addtogroup KERNEL_PAR_NVM_FUNCTIONS
+	* @{ <!-- BEGIN GROUP -->
+	*
+	* 	Kernel functions of device parameters NVM handling
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+
+	#if ( 0 == PAR_CFG_NVM_JOURNAL_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Corrupt parameter signature to NVM
+		*
+		* @brief	Return ePAR_OK if signature corrupted OK. In case of NVM error it returns
+		* 			ePAR_ERROR_NVM.
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t	par_nvm_corrupt_signature(void)
+		{
+			par_status_t status = ePAR_OK;
+
+			if ( eNVM_OK != par_nvm_io_erase( ( PAR_NVM_ACTIVE_BANK_ADDR + PAR_NVM_HEAD_SIGN_ADDR ), PAR_NVM_SIGN_SIZE ))
+			{
+				status = ePAR_ERROR_NVM;
+				PAR_DBG_PRINT( "PAR_NVM: NVM error during signature corruption!" );
+			}
+
+			return status;
+		}
+
+		#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Check unique parameter table ID
+			*
+			* @brief	This function check for parameter configuration table change while
+			* 			some parameters are already stored in NVM. It read stored table ID
+			* 			from NVM and compare it with current table ID. In case of mismatch
+			* 			it return error.
+			*
+			* 			Table ID is hash of parameter layout (ID, type, persistence) only,
+			* 			see "PAR_NVM_TABLE_ID_MIX". With static layout it is calculated
+			* 			at compile time, thus check takes only NVM read and compare.
+			*
+			* @return		status 		- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_check_table_id(const uint32_t addr)
+			{
+				par_status_t 	status 									= ePAR_OK;
+				uint32_t 		nvm_table_id[PAR_NVM_TABLE_ID_WORD_NUM] = { 0 };
+
+				if ( eNVM_OK != par_nvm_io_read( addr, PAR_NVM_TABLE_ID_SIZE, (uint8_t*) &nvm_table_id ))
+				{
+					status = ePAR_ERROR_NVM;
+					PAR_DBG_PRINT( "PAR_NVM: NVM error during table ID read!" );
+				}
+				else
+				{
+					// Table ID is the same in "RAM" and in NVM
+					if ( 0 == memcmp( &nvm_table_id, &gu32_par_nvm_table_id, PAR_NVM_TABLE_ID_SIZE ))
+					{
+						status = ePAR_OK;
+					}
+
+					// Different table ID found
+					else
+					{
+						status = ePAR_ERROR;
+						PAR_DBG_PRINT( "PAR_NVM: Parameter table ID mismatch!" );
+					}
+				}
+
+				return status;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Write unique parameter table ID to NVM
+			*
+			* @return		status 		- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_write_table_id(void)
+			{
+				par_status_t status = ePAR_OK;
+
+				if ( eNVM_OK != par_nvm_io_write( ( PAR_NVM_ACTIVE_BANK_ADDR + PAR_NVM_HEAD_HASH_ADDR ), PAR_NVM_TABLE_ID_SIZE, (const uint8_t*) &gu32_par_nvm_table_id ))
+				{
+					status = ePAR_ERROR_NVM;
+					PAR_DBG_PRINT( "PAR_NVM: NVM error during table ID write!" );
+				}
+
+				return status;
+			}
+
+			#if ( 0 == PAR_CFG_STATIC_LAYOUT_EN )
+
+				////////////////////////////////////////////////////////////////////////////////
+				/**
+				*		Calculate unique parameter table ID
+				*
+				* @note		Gives the same result as compile time calculation
+				* 			with static layout.
+				*
+				* @return		void
+				*/
+				////////////////////////////////////////////////////////////////////////////////
+				static void par_nvm_calc_table_id(void)
+				{
+					par_num_t	par_num	= 0;
+					par_cfg_t	par_cfg	= {0};
+					uint32_t	word	= 0UL;
+
+					for ( word = 0UL; word < PAR_NVM_TABLE_ID_WORD_NUM; word++ )
+					{
+						gu32_par_nvm_table_id[word] = 0UL;
+
+						for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+						{
+							par_get_config( par_num, &par_cfg );
+
+							gu32_par_nvm_table_id[word] += PAR_NVM_TABLE_ID_MIX( word, par_cfg.id, par_cfg.type, par_cfg.persistant );
+						}
+					}
+				}
+
+			#endif
+
+		#endif // 1 == PAR_CFG_TABLE_ID_CHECK_EN
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Read parameter NVM header
+		*
+		* @param[in]	p_head_obj	- Pointer to parameter NVM header
+		* @return		status 		- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_read_header(par_nvm_head_obj_t * const p_head_obj)
+		{
+			par_status_t status = ePAR_OK;
+
+			PAR_ASSERT( NULL != p_head_obj );
+
+			if ( eNVM_OK != par_nvm_io_read( ( PAR_NVM_ACTIVE_BANK_ADDR + PAR_NVM_HEAD_ADDR ), sizeof( par_nvm_head_obj_t ), (uint8_t*) p_head_obj ))
+			{
+				status = ePAR_ERROR_NVM;
+				PAR_DBG_PRINT( "PAR_NVM: NVM error during header read!" );
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Write parameter NVM header
+		*
+		* @param[in]	num_of_par	- Number of persistent parameters that are stored in NVM
+		* @return		status 		- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t	par_nvm_write_header(const uint16_t num_of_par)
+		{
+			par_status_t 		status 		= ePAR_OK;
+			par_nvm_head_obj_t	head_obj	= {0};
+
+			// Add number of objects
+			head_obj.obj_nb = num_of_par;
+
+			// Add bank generation
+			#if ( 1 == PAR_CFG_NVM_AB_EN )
+				head_obj.gen = gu32_par_nvm_gen;
+			#endif
+
+			// Calculate CRC
+			head_obj.crc = par_nvm_calc_head_crc( &head_obj );
+
+			// Set signature
+			head_obj.sign = PAR_NVM_SIGN_ACT;
+
+			// Write table ID
+			#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
+				status = par_nvm_write_table_id();
+			#endif
+
+			// Write num of object and CRC
+			if ( ePAR_OK != status )
+			{
+				// No actions...
+			}
+			else if ( eNVM_OK != par_nvm_io_write( ( PAR_NVM_ACTIVE_BANK_ADDR + PAR_NVM_HEAD_ADDR ), sizeof( par_nvm_head_obj_t ), (const uint8_t*) &head_obj ))
+			{
+				status = ePAR_ERROR_NVM;
+				PAR_DBG_PRINT( "PAR_NVM: NVM error during header write!" );
+			}
+			else
+			{
+				gu16_par_nvm_obj_nb = num_of_par;
+			}
+
+			PAR_DBG_PRINT( "PAR_NVM: Write NVM header with %d nb. of object", num_of_par );
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Validate parameter NVM header
+		*
+		* @param[out]	p_head_obj		- Pointer to valid parameter NVM header
+		* @return		status 			- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_validate_header(par_nvm_head_obj_t * const p_head_obj)
+		{
+			par_status_t 		status 		= ePAR_OK;
+			par_nvm_head_obj_t 	obj_head	= { 0 };
+			uint16_t 			crc_calc	= 0;
+
+			// Read header
+			status = par_nvm_read_header( &obj_head );
+
+			// NVM error
+			if ( ePAR_ERROR_NVM == status )
+			{
+				// No actions...
+			}
+			else
+			{
+				// Check for signature
+				// NOTE: Fixed object format is always supported as it is loaded the same way!
+				if 	(	( PAR_NVM_SIGN_ACT == obj_head.sign )
+					||	( PAR_NVM_SIGN == obj_head.sign ))
+				{
+					// Calculate CRC
+					crc_calc = par_nvm_calc_head_crc( &obj_head );
+
+					// Validate CRC
+					if ( crc_calc == obj_head.crc )
+					{
+						// Check table ID
+						// NOTE: Changed table is handled as invalid signature!
+						#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
+							status = par_nvm_check_table_id( PAR_NVM_ACTIVE_BANK_ADDR + PAR_NVM_HEAD_HASH_ADDR );
+						#endif
+
+						if ( ePAR_OK == status )
+						{
+							*p_head_obj = obj_head;
+							PAR_DBG_PRINT( "PAR_NVM: HVM header OK! Nb. of stored obj: %d", obj_head.obj_nb );
+						}
+					}
+
+					// CRC corrupt
+					else
+					{
+						status = ePAR_ERROR_CRC;
+						PAR_DBG_PRINT( "PAR_NVM: Header CRC corrupted!" );
+
+						#if ( 1 == PAR_CFG_STATS_EN )
+							g_par_nvm_stats.crc_err_cnt++;
+						#endif
+					}
+				}
+				else
+				{
+					status = ePAR_ERROR;
+					PAR_DBG_PRINT( "PAR_NVM: Signature corrupted!" );
+				}
+			}
+
+			return status;
+		}
+
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Calculate parameter NVM header CRC
+		*
+		* @param[in]	p_head_obj	- Pointer to parameter NVM header
+		* @return		crc16		- Calculated CRC
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static uint16_t par_nvm_calc_head_crc(const par_nvm_head_obj_t * const p_head_obj)
+		{
+			uint16_t crc = 0;
+
+			crc = par_nvm_calc_crc((const uint8_t*) &p_head_obj->obj_nb, PAR_NVM_NB_OF_OBJ_SIZE );
+
+			#if ( 1 == PAR_CFG_NVM_AB_EN )
+				crc ^= par_nvm_calc_crc((const uint8_t*) &p_head_obj->gen, PAR_NVM_GEN_SIZE );
+			#endif
+
+			return crc;
+		}
+
+	#endif // 0 == PAR_CFG_NVM_JOURNAL_EN
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Calculate CRC-16
+	*
+	* @note		CRC-16-CCITT (poly 0x1021, non-reflected) with custom seed.
+	* 			Calculation method is selected by "PAR_CFG_NVM_CRC_TABLE_SIZE"
+	* 			and "PAR_CFG_NVM_CRC_HW_EN" settings, all of them give the same
+	* 			result.
+	*
+	* @param[in]	p_data	- Pointer to data
+	* @param[in]	size	- Size of data to calc crc
+	* @return		crc16	- Calculated CRC
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint16_t par_nvm_calc_crc(const uint8_t * const p_data, const uint8_t size)
+	{
+		const 	uint16_t seed 	= 0x1234U;	// Custom seed
+				uint16_t crc16 	= seed;
+
+		// Check input
+		PAR_ASSERT( NULL != p_data );
+		PAR_ASSERT( size > 0 );
+
+		#if ( 1 == PAR_CFG_NVM_CRC_HW_EN )
+
+			// Calculate by MCU CRC peripheral
+			crc16 = par_if_calc_crc( p_data, size, seed );
+
+		#elif ( 256 == PAR_CFG_NVM_CRC_TABLE_SIZE )
+
+			for ( uint8_t i = 0; i < size; i++ )
+			{
+				crc16 = (uint16_t)(( crc16 << 8U ) ^ gu16_par_nvm_crc_table[ (uint8_t)(( crc16 >> 8U ) ^ p_data[i] ) ]);
+			}
+
+		#elif ( 16 == PAR_CFG_NVM_CRC_TABLE_SIZE )
+
+			for ( uint8_t i = 0; i < size; i++ )
+			{
+				// High nibble first
+				crc16 = (uint16_t)(( crc16 << 4U ) ^ gu16_par_nvm_crc_table[ (( crc16 >> 12U ) ^ ( p_data[i] >> 4U )) & 0x0FU ]);
+				crc16 = (uint16_t)(( crc16 << 4U ) ^ gu16_par_nvm_crc_table[ (( crc16 >> 12U ) ^ ( p_data[i] & 0x0FU )) & 0x0FU ]);
+			}
+
+		#else
+
+			const uint16_t poly = 0x1021U;	// CRC-16-CCITT
+
+		    for (uint8_t i = 0; i < size; i++)
+		    {
+		    	crc16 = ( crc16 ^ ( p_data[i] << 8U ));
+
+		        for (uint8_t j = 0U; j < 8U; j++)
+		        {
+		        	if (crc16 & 0x8000)
+		        	{
+		        		crc16 = (( crc16 << 1U ) ^ poly );
+		            }
+		        	else
+		            {
+		        		crc16 = ( crc16 << 1U );
+		            }
+		        }
+		    }
+
+		#endif
+
+		return crc16;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Calculate parameter data object CRC
+	*
+	* @note		Only "size" bytes of data are part of CRC, which is whole
+	* 			value storage in fixed object format.
+	*
+	* @param[in]	p_obj	- Pointer to data object
+	* @return		crc16	- Calculated CRC
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint8_t par_nvm_calc_obj_crc(const par_nvm_data_obj_t * const p_obj)
+	{
+		uint16_t 	crc 	= 0;
+		uint8_t 	rtn_crc = 0;
+
+		crc = par_nvm_calc_crc((const uint8_t*) &p_obj->id, 		2 );
+		crc ^= par_nvm_calc_crc((const uint8_t*) &p_obj->size, 		1 );
+		crc ^= par_nvm_calc_crc((const uint8_t*) p_obj->data, 		p_obj->size );
+		rtn_crc = ( crc & 0xFFU );
+
+		return rtn_crc;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Create parameter NVM data object from live value
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @param[out]	p_obj	- Pointer to data object
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_nvm_make_obj(const par_num_t par_num, par_nvm_data_obj_t * const p_obj)
+	{
+		// Get current par value
+		memset( p_obj->data, 0, sizeof( p_obj->data ));
+		par_get( par_num, p_obj->data );
+
+		// Get parameter ID
+		(void) par_get_id( par_num, &p_obj->id );
+
+		// Get parameter data size
+		p_obj->size = par_nvm_get_data_size( par_num );
+
+		// Calculate CRC
+		p_obj->crc = par_nvm_calc_obj_crc( p_obj );
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Check parameter NVM data object loaded from NVM
+	*
+	* @note		Data size is checked first as CRC is calculated over it.
+	*
+	* @param[in]	p_obj	- Pointer to data object
+	* @return		is_ok	- Data object valid
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static bool par_nvm_check_obj(const par_nvm_data_obj_t * const p_obj)
+	{
+		bool is_ok = false;
+
+		if 	(	( p_obj->size > 0U )
+			&&	( p_obj->size <= sizeof( par_type_t )))
+		{
+			if ( par_nvm_calc_obj_crc( p_obj ) == p_obj->crc )
+			{
+				is_ok = true;
+			}
+		}
+
+		#if ( 1 == PAR_CFG_STATS_EN )
+			if ( true != is_ok )
+			{
+				g_par_nvm_stats.crc_err_cnt++;
+			}
+		#endif
+
+		return is_ok;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get size of parameter data stored in NVM data object
+	*
+	* @note		In fixed object format whole "par_type_t" storage is used,
+	* 			otherwise only parameter type size.
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @return		size	- Size of data in bytes
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint8_t par_nvm_get_data_size(const par_num_t par_num)
+	{
+		uint8_t size = sizeof( par_type_t );
+
+		#if ( 1 == PAR_CFG_NVM_PACKED_EN )
+			par_type_list_t type = ePAR_TYPE_NUM_OF;
+
+			(void) par_get_type( par_num, &type );
+			(void) par_get_type_size( type, &size );
+		#else
+			(void) par_num;
+		#endif
+
+		return size;
+	}
+
+	#if ( 0 == PAR_CFG_NVM_JOURNAL_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Load all parameters value from NVM
+		*
+		* @brief	Data objects are read in chunks of "PAR_CFG_NVM_LOAD_BUF_SIZE"
+		* 			bytes, thus number of NVM transactions is reduced. Objects are
+		* 			then validated and applied from RAM.
+		*
+		* @param[in]	num_of_par	- Number of stored parameters inside NVM
+		* @return		status 		- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_load_all(const uint16_t num_of_par)
+		{
+			par_status_t 	status 	= ePAR_OK;
+			par_nvm_load_t	load	= { .obj_addr = PAR_NVM_FIRST_DATA_OBJ_ADDR, .obj_num = num_of_par };
+
+			// Nothing loaded jet
+			memset( g_par_nvm_data_obj_addr, 0, sizeof( g_par_nvm_data_obj_addr ));
+
+			// Loop thru stored NVM objects chunk by chunk
+			while (( ePAR_OK == status ) && ( load.obj_idx < num_of_par ))
+			{
+				status = par_nvm_load_chunk( &load );
+			}
+
+			PAR_DBG_PRINT( "PAR_NVM: Loading all persistent parameters with status: %s", par_get_status_str(status));
+			PAR_DBG_PRINT( "PAR_NVM: Nb. of stored pars in NVM: %d", num_of_par );
+			PAR_DBG_PRINT( "PAR_NVM: Nb. of live persistent: \t%d", par_nvm_get_per_par());
+
+			// Find new persistent parameter
+			if ( ePAR_OK == status )
+			{
+				status = par_nvm_load_new( num_of_par, load.obj_addr );
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Load next chunk of parameters value from NVM
+		*
+		* @note		Chunk ends with last whole data object inside load buffer,
+		* 			next chunk starts right after it.
+		*
+		* @param[in,out]	p_load	- Pointer to load progress
+		* @return			status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_load_chunk(par_nvm_load_t * const p_load)
+		{
+			par_status_t 		status 		= ePAR_OK;
+			uint8_t * const		p_buf		= (uint8_t*) &g_par_nvm_load_buf;
+			par_nvm_data_obj_t	obj_data	= { 0 };
+			uint32_t			buf_size	= 0;
+			uint32_t			buf_pos		= 0;
+
+			// Chunk size, no more than remaining objects can take
+			buf_size = (( p_load->obj_num - p_load->obj_idx ) * sizeof( par_nvm_data_obj_t ));
+
+			if ( buf_size > sizeof( g_par_nvm_load_buf ))
+			{
+				buf_size = sizeof( g_par_nvm_load_buf );
+			}
+
+			// Load chunk of parameter NVM objects
+			if ( eNVM_OK != par_nvm_io_read( ( PAR_NVM_ACTIVE_BANK_ADDR + p_load->obj_addr ), buf_size, p_buf ))
+			{
+				status = ePAR_ERROR_NVM;
+			}
+
+			// Apply whole objects from chunk
+			for ( buf_pos = 0; (( ePAR_OK == status ) && ( p_load->obj_idx < p_load->obj_num ) && (( buf_pos + PAR_NVM_DATA_OBJ_HEAD_SIZE ) <= buf_size )); p_load->obj_idx++ )
+			{
+				memcpy( &obj_data, &p_buf[buf_pos], PAR_NVM_DATA_OBJ_HEAD_SIZE );
+
+				// Corrupted size
+				if 	(	( 0U == obj_data.size )
+					||	( obj_data.size > sizeof( par_type_t )))
+				{
+					status = ePAR_ERROR_CRC;
+					break;
+				}
+
+				// Object continues in next chunk
+				if (( buf_pos + PAR_NVM_DATA_OBJ_HEAD_SIZE + obj_data.size ) > buf_size )
+				{
+					break;
+				}
+
+				memset( obj_data.data, 0, sizeof( obj_data.data ));
+				memcpy( obj_data.data, &p_buf[ buf_pos + PAR_NVM_DATA_OBJ_HEAD_SIZE ], obj_data.size );
+
+				status = par_nvm_load_obj( &obj_data, ( p_load->obj_addr + buf_pos ));
+
+				if ( ePAR_OK != status )
+				{
+					break;
+				}
+
+				buf_pos += ( PAR_NVM_DATA_OBJ_HEAD_SIZE + obj_data.size );
+			}
+
+			// Next chunk starts after last whole object
+			if ( ePAR_OK == status )
+			{
+				p_load->obj_addr += buf_pos;
+			}
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Add new persistent parameters to NVM
+		*
+		* @brief	Persistent parameters not found between stored objects are
+		* 			added to NVM LUT after last object and written to NVM
+		* 			together with updated header.
+		*
+		* @note		With "PAR_CFG_PROFILE_EN" image that would grow into profile
+		* 			slots is re-written compactly instead.
+		*
+		* @param[in]	num_of_par	- Number of stored parameters inside NVM
+		* @param[in]	obj_addr	- Address after last stored object
+		* @return		status 		- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_load_new(const uint16_t num_of_par, uint32_t obj_addr)
+		{
+			par_status_t 	status 		= ePAR_OK;
+			par_cfg_t		par_cfg		= {0};
+			uint16_t 		new_par_cnt	= 0;
+
+			#if ( 0 == PAR_CFG_NVM_AB_EN )
+				bool		is_full		= false;
+			#endif
+
+			for ( uint16_t i = 0; i < ePAR_NUM_OF; i++ )
+			{
+				par_get_config( i, &par_cfg );
+
+				if ( true == par_cfg.persistant )
+				{
+					if ( false == par_nvm_is_in_nvm_lut( i ))
+					{
+						// Is persistant and not jet in NVM lut -> Add to LUT after last object
+						par_nvm_lut_set( i, obj_addr );
+
+						obj_addr += ( PAR_NVM_DATA_OBJ_HEAD_SIZE + par_nvm_get_data_size( i ));
+
+						// Object would overwrite profile slots
+						#if ( 1 == PAR_CFG_PROFILE_EN ) && ( 0 == PAR_CFG_NVM_AB_EN )
+							if ( obj_addr > PAR_CFG_NVM_PROFILE_ADDR )
+							{
+								is_full = true;
+							}
+						#endif
+
+						// Write new par to NVM
+						// NOTE: With A/B banks all are written at commit bellow!
+						#if ( 0 == PAR_CFG_NVM_AB_EN )
+							if ( false == is_full )
+							{
+								par_save( i );
+							}
+						#else
+							gu32_par_nvm_ab_pending[ i / 32U ] |= ( 1UL << ( i % 32U ));
+						#endif
+
+						new_par_cnt++;
+					}
+				}
+			}
+
+			// If there is a new persistent parameter change HVM header
+			if ( new_par_cnt > 0 )
+			{
+				#if ( 1 == PAR_CFG_NVM_AB_EN )
+
+					// Write all to inactive bank and commit
+					status |= par_nvm_ab_commit();
+					(void) num_of_par;
+
+				#else
+
+					// No space left for appended objects, re-write image compactly
+					if ( true == is_full )
+					{
+						status |= par_nvm_reset_all();
+						status |= ePAR_WARN_NVM_REWRITTEN;
+						PAR_DBG_PRINT( "PAR_NVM: NVM image re-written as it would overlap with profiles!" );
+					}
+					else
+					{
+						// Add additional new persistent parameters number to existing one!
+						// NOTE: In general obj number will only rise!
+						status |= par_nvm_write_header( num_of_par + new_par_cnt );
+
+		                // Sync NVM
+		                status |= par_nvm_sync();
+					}
+
+                #endif
+
+				#if ( PAR_CFG_DEBUG_EN )
+					PAR_DBG_PRINT( "PAR_NVM: Added %d new parameters to NVM LUT table!", new_par_cnt );
+				#endif
+			}
+
+			return status;
+		}
+
+		#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Start lazy loading of parameters value from NVM
+			*
+			* @brief	Chunks are loaded until all critical parameters are
+			* 			found, rest of stored objects are left for background
+			* 			loading. Image in other format than active one is
+			* 			loaded completely, as it gets migrated at init.
+			*
+			* @param[in]	p_head_obj	- Pointer to validated NVM header
+			* @return		status 		- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_load_start(const par_nvm_head_obj_t * const p_head_obj)
+			{
+				par_status_t status = ePAR_OK;
+
+				if ( PAR_NVM_SIGN_ACT != p_head_obj->sign )
+				{
+					status = par_nvm_load_all( p_head_obj->obj_nb );
+				}
+				else
+				{
+					g_par_nvm_load.obj_addr = PAR_NVM_FIRST_DATA_OBJ_ADDR;
+					g_par_nvm_load.obj_num 	= p_head_obj->obj_nb;
+					g_par_nvm_load.obj_idx	= 0U;
+					g_par_nvm_load.done		= false;
+
+					// Nothing loaded jet
+					memset( g_par_nvm_data_obj_addr, 0, sizeof( g_par_nvm_data_obj_addr ));
+
+					// Load critical parameters
+					while 	(	( ePAR_OK == status )
+							&&	( false == g_par_nvm_load.done )
+							&&	( false == par_nvm_is_critical_loaded()))
+					{
+						status = par_nvm_load_next();
+					}
+
+					PAR_DBG_PRINT( "PAR_NVM: Loading critical parameters with status: %s", par_get_status_str(status));
+					PAR_DBG_PRINT( "PAR_NVM: Nb. of loaded objects: %d/%d", g_par_nvm_load.obj_idx, g_par_nvm_load.obj_num );
+				}
+
+				return status;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Load next chunk of lazy loaded parameters
+			*
+			* @note		After last chunk new persistent parameters are added to NVM
+			* 			and all parameters are marked as loaded. The same is done
+			* 			on error, as rest of stored objects can not be trusted.
+			*
+			* @return		status 	- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_load_next(void)
+			{
+				par_status_t status = ePAR_OK;
+
+				if ( g_par_nvm_load.obj_idx < g_par_nvm_load.obj_num )
+				{
+					status = par_nvm_load_chunk( &g_par_nvm_load );
+				}
+
+				if 	(	( ePAR_OK != status )
+					||	( g_par_nvm_load.obj_idx >= g_par_nvm_load.obj_num ))
+				{
+					g_par_nvm_load.done = true;
+					par_set_loaded_all();
+
+					// Find new persistent parameter
+					if ( ePAR_OK == status )
+					{
+						status = par_nvm_load_new( g_par_nvm_load.obj_num, g_par_nvm_load.obj_addr );
+					}
+
+					PAR_DBG_PRINT( "PAR_NVM: Lazy loading done with status: %s", par_get_status_str(status));
+				}
+
+				return status;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Load parameters from NVM until given one is loaded
+			*
+			* @param[in]	par_num	- Parameter number (enumeration) or ePAR_NUM_OF to load all
+			* @return		status 	- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_load_until(const par_num_t par_num)
+			{
+				par_status_t 	status 		= ePAR_OK;
+				bool			is_loaded	= false;
+
+				#if ( 1 == PAR_CFG_MUTEX_EN )
+					if ( ePAR_OK == par_if_aquire_nvm_mutex())
+					{
+				#endif
+						while (( ePAR_OK == status ) && ( false == g_par_nvm_load.done ))
+						{
+							// Requested parameter loaded
+							if ( par_num < ePAR_NUM_OF )
+							{
+								(void) par_is_loaded( par_num, &is_loaded );
+
+								if ( true == is_loaded )
+								{
+									break;
+								}
+							}
+
+							status = par_nvm_load_fault( par_nvm_load_next());
+						}
+
+				#if ( 1 == PAR_CFG_MUTEX_EN )
+						par_if_release_nvm_mutex();
+					}
+
+					// Mutex not acquire
+					else
+					{
+						status = ePAR_ERROR;
+					}
+				#endif
+
+				return status;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Handle error of lazy loading after init
+			*
+			* @note		Corrupted NVM image is re-written with live values, the
+			* 			same as at init. On NVM error live values are kept, as
+			* 			they might already be changed by application.
+			*
+			* @param[in]	load_status	- Status of load
+			* @return		status 		- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_load_fault(const par_status_t load_status)
+			{
+				par_status_t status = load_status;
+
+				// Load CRC error
+				if ( ePAR_ERROR_CRC == status )
+				{
+					status = par_nvm_reset_all();
+
+					status |= ePAR_WARN_SET_TO_DEF;
+					status |= ePAR_WARN_NVM_REWRITTEN;
+				}
+
+				return status;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Check if all critical parameters are loaded from NVM
+			*
+			* @return		is_loaded - True if all critical parameters are loaded
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static bool par_nvm_is_critical_loaded(void)
+			{
+				bool is_loaded = true;
+
+				for ( uint16_t pos = 0; ( pos < gu16_par_nvm_crit_num ) && ( true == is_loaded ); pos++ )
+				{
+					(void) par_is_loaded( PAR_NVM_OBJ_ORDER( pos ), &is_loaded );
+				}
+
+				return is_loaded;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Build order of parameters inside NVM image
+			*
+			* @note		Critical persistent parameters come first, others follow
+			* 			in order of parameter number.
+			*
+			* @return	void
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static void par_nvm_build_obj_order(void)
+			{
+				par_cfg_t	par_cfg	= {0};
+				uint16_t	pos		= 0U;
+
+				// Critical persistent parameters
+				for ( uint16_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+				{
+					par_get_config( par_num, &par_cfg );
+
+					if (( true == par_cfg.persistant ) && ( true == par_cfg.critical ))
+					{
+						gu16_par_nvm_obj_order[pos++] = par_num;
+					}
+				}
+
+				gu16_par_nvm_crit_num = pos;
+
+				// All the others
+				for ( uint16_t par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+				{
+					par_get_config( par_num, &par_cfg );
+
+					if (( true != par_cfg.persistant ) || ( true != par_cfg.critical ))
+					{
+						gu16_par_nvm_obj_order[pos++] = par_num;
+					}
+				}
+			}
+
+		#endif // 1 == PAR_CFG_NVM_LAZY_EN
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Validate and apply parameter NVM object loaded from NVM
+		*
+		* @param[in]	p_obj			- Pointer to loaded NVM data object
+		* @param[in]	obj_addr		- NVM address of data object
+		* @return		status 			- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_load_obj(const par_nvm_data_obj_t * const p_obj, const uint32_t obj_addr)
+		{
+			par_status_t 	status 		= ePAR_OK;
+			par_num_t 		par_num		= 0;
+			par_cfg_t		par_cfg		= {0};
+			bool			is_match	= false;
+
+			// Size and CRC OK
+			if ( true == par_nvm_check_obj( p_obj ))
+			{
+				// Is that parameter in current table
+				if ( ePAR_OK == par_get_num_by_id( p_obj->id, &par_num ))
+				{
+					par_get_config( par_num, &par_cfg );
+
+					/**
+					 * 	Parameter found in device and stored in NVM
+					 *
+					 * 	Check if that parameter is still persistent!
+					 */
+					if ( true == par_cfg.persistant )
+					{
+						// Check if already in LUT
+						if ( false == par_nvm_is_in_nvm_lut( par_num ))
+						{
+							/**
+							 * 	Add to NVM lut
+							 *
+							 * 	@note	Object can be re-written in place only if its
+							 * 			size match, otherwise it is added as new one.
+							 */
+							is_match = ( par_nvm_get_data_size( par_num ) == p_obj->size );
+
+							if ( true == is_match )
+							{
+								par_nvm_lut_set( par_num, obj_addr );
+							}
+
+							/**
+							 * 	Set parameter
+							 *
+							 * 	@note	Object of other size is followed by newer one
+							 * 			once added, thus lazy loading keeps looking
+							 * 			for it. Otherwise newer one simply overrides it.
+							 */
+							#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+								par_set_loaded( par_num, p_obj->data, is_match );
+							#else
+								par_set( par_num, p_obj->data );
+							#endif
+						}
+					}
+				}
+
+				// Parameter not in current table
+				else
+				{
+					// No action...
+				}
+			}
+
+			// CRC corrupted
+			else
+			{
+				status = ePAR_ERROR_CRC;
+			}
+
+			return status;
+		}
+
+	#endif // 0 == PAR_CFG_NVM_JOURNAL_EN
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get total number of persistent parameters
+	*
+	* @return	num_of_per_par - Number of persistent parameters
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint16_t	par_nvm_get_per_par(void)
+	{
+		uint16_t 	num_of_per_par 	= 0UL;
+		uint16_t 	par_num 		= 0UL;
+		par_cfg_t	par_cfg			= {0};
+
+		for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+		{
+			par_get_config( par_num, &par_cfg );
+
+			if ( true == par_cfg.persistant )
+			{
+				num_of_per_par++;
+			}
+		}
+
+		return num_of_per_par;
+	}
+
+	#if ( 0 == PAR_CFG_NVM_JOURNAL_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
 		/**
-		*		Check unique parameter table ID
+		*		Build new parameter NVM LUT table
 		*
-		* @brief	This function check for parameter configuration table change while
-		* 			some parameters are already stored in NVM. First it read stored
-		* 			table ID from NVM and then compare it with current table ID (live
-		* 			from RAM). In case of mismatched it return error.
-		*
-		* 			Table ID is being calculated based on hash algorithm (SHA-256).
-		*
-		* @param[in]	p_table_id	- Pointer to reference table ID (in "RAM")
-		* @return		status 		- Status of operation
+		* @return	void
 		*/
 		////////////////////////////////////////////////////////////////////////////////
-		static par_status_t par_nvm_check_table_id(const uint8_t * const p_table_id)
+		static void par_nvm_build_new_nvm_lut(void)
 		{
-			par_status_t 	status 				= ePAR_OK;
-			uint8_t 		nvm_table_id[32] 	= { 0 };
+			uint32_t 		obj_addr 			= PAR_NVM_FIRST_DATA_OBJ_ADDR;
+			par_num_t		par_num				= 0;
+			par_cfg_t		par_cfg				= {0};
+			uint16_t		obj_nb				= 0U;
 
-			if ( eNVM_OK != nvm_read( eNVM_REGION_EEPROM_RUN_PAR, PAR_NVM_TABLE_ID_ADDR_OFFSET, 32U, (uint8_t*) &nvm_table_id ))
-			{
-				status = ePAR_ERROR_NVM;
-			}
-			else
+			// Loop thru all parameters
+			for ( uint16_t pos = 0; pos < ePAR_NUM_OF; pos++ )
 			{
-				// Table ID is the same in "RAM" and in NVM
-				if ( 0 == memcmp( &nvm_table_id, p_table_id, 32U ))
+				par_num = PAR_NVM_OBJ_ORDER( pos );
+				par_get_config( par_num, &par_cfg );
+
+				if ( true == par_cfg.persistant )
 				{
-					status = ePAR_OK;
-				}
+					// Build consecutive address space
+					par_nvm_lut_set( par_num, obj_addr );
+					obj_nb++;
 
-				// Different table ID found
+					// Next persistent parameter
+					obj_addr += ( PAR_NVM_DATA_OBJ_HEAD_SIZE + par_nvm_get_data_size( par_num ));
+				}
 				else
 				{
-					status = ePAR_ERROR;
+					par_nvm_lut_clear( par_num );
 				}
 			}
 
-			return status;
+			// Image holds only objects of persistent parameters
+			gu16_par_nvm_obj_nb = obj_nb;
+        
+	        // Show NVM LUT table
+			par_nvm_print_nvm_lut();
 		}
 
 		////////////////////////////////////////////////////////////////////////////////
 		/**
-		*		Write unique parameter table ID to NVM
+		*		Get parameter NVM object start address
 		*
-		* @param[in]	p_table_id	- Pointer to reference table ID (in "RAM")
-		* @return		status 		- Status of operation
+		* @note		Parameter not found in NVM lut is reported as error, as there
+		* 			is a problem with building the NVM lut!
+		*
+		* @param[in]	par_num		- Parameter number (enumeration)
+		* @param[out]	p_addr		- Pointer to NVM address of parameter object
+		* @return		status		- Status of operation
 		*/
 		////////////////////////////////////////////////////////////////////////////////
-		static par_status_t par_nvm_write_table_id(const uint8_t * const p_table_id)
+		static par_status_t par_nvm_get_nvm_lut_addr(const par_num_t par_num, uint32_t * const p_addr)
 		{
 			par_status_t status = ePAR_OK;
 
-			if ( eNVM_OK != nvm_write( eNVM_REGION_EEPROM_RUN_PAR, PAR_NVM_TABLE_ID_ADDR_OFFSET, 32U, p_table_id ))
+			if ( true == par_nvm_is_in_nvm_lut( par_num ))
 			{
-				status = ePAR_ERROR_NVM;
+				*p_addr = g_par_nvm_data_obj_addr[par_num].addr;
+			}
+			else
+			{
+				status = ePAR_ERROR;
+				PAR_DBG_PRINT( "PAR_NVM: Parameter %d not in NVM lut!", par_num );
 			}
 
 			return status;
 		}
 
-	#endif // 1 == PAR_CFG_TABLE_ID_CHECK_EN
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Check if parameter is in NVM LUT
+		*
+		* @param[in]	par_num		- Parameter number (enumeration)
+		* @return		is_in_lut	- Flag that indicated if object is in NVM lut
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static bool	par_nvm_is_in_nvm_lut(const par_num_t par_num)
+		{
+			bool is_in_lut = false;
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Read parameter NVM header
-	*
-	* @param[in]	p_head_obj	- Pointer to parameter NVM header
-	* @return		status 		- Status of operation
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	static par_status_t par_nvm_read_header(par_nvm_head_obj_t * const p_head_obj)
-	{
-		par_status_t status = ePAR_OK;
+			if ( par_num < ePAR_NUM_OF )
+			{
+				#if ( 1 == PAR_CFG_COMPACT_EN )
+					is_in_lut = ( 0U != g_par_nvm_data_obj_addr[par_num].addr );
+				#else
+					is_in_lut = g_par_nvm_data_obj_addr[par_num].valid;
+				#endif
+			}
 
-		PAR_ASSERT( NULL != p_head_obj );
+			return is_in_lut;
+		}
 
-		if ( eNVM_OK != nvm_read( PAR_CFG_NVM_REGION, PAR_NVM_HEAD_ADDR, sizeof( par_nvm_head_obj_t ), (uint8_t*) p_head_obj ))
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Add parameter to NVM LUT
+		*
+		* @note		With "PAR_CFG_COMPACT_EN" object address above 16-bit range
+		* 			is not added, thus parameter is reported as not in LUT.
+		*
+		* @param[in]	par_num		- Parameter number (enumeration)
+		* @param[in]	addr		- NVM address of parameter object
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static void par_nvm_lut_set(const par_num_t par_num, const uint32_t addr)
 		{
-			status = ePAR_ERROR_NVM;
-			PAR_DBG_PRINT( "PAR_NVM: NVM error during header read!" );
+			#if ( 1 == PAR_CFG_COMPACT_EN )
+				PAR_ASSERT( addr <= UINT16_MAX );
+
+				if ( addr <= UINT16_MAX )
+				{
+					g_par_nvm_data_obj_addr[par_num].addr = (uint16_t) addr;
+				}
+			#else
+				g_par_nvm_data_obj_addr[par_num].addr 	= addr;
+				g_par_nvm_data_obj_addr[par_num].valid 	= true;
+			#endif
 		}
 
-		return status;
-	}
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Remove parameter from NVM LUT
+		*
+		* @param[in]	par_num		- Parameter number (enumeration)
+		* @return		void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static void par_nvm_lut_clear(const par_num_t par_num)
+		{
+			g_par_nvm_data_obj_addr[par_num].addr = 0U;
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Write parameter NVM header
-	*
-	* @param[in]	num_of_par	- Number of persistent parameters that are stored in NVM
-	* @return		status 		- Status of operation
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	static par_status_t	par_nvm_write_header(const uint16_t num_of_par)
-	{
-		par_status_t 		status 		= ePAR_OK;
-		par_nvm_head_obj_t	head_obj	= {0};
+			#if ( 0 == PAR_CFG_COMPACT_EN )
+				g_par_nvm_data_obj_addr[par_num].valid = false;
+			#endif
+		}
 
-		// Add number of objects
-		head_obj.obj_nb = num_of_par;
 
-		// Calculate CRC
-		head_obj.crc = par_nvm_calc_crc((uint8_t*) &head_obj.obj_nb, PAR_NVM_NB_OF_OBJ_SIZE );
+		#if ( 1 == PAR_CFG_NVM_AB_EN )
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Select active parameter NVM bank
+			*
+			* @brief	Bank with valid header and newest generation is selected.
+			* 			Generation comparison handles counter overflow.
+			*
+			* @param[out]	p_head_obj	- Pointer to header of selected bank
+			* @return		status 		- Status of operation, ePAR_ERROR if no valid bank
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_ab_select_bank(par_nvm_head_obj_t * const p_head_obj)
+			{
+				par_status_t 		status 		= ePAR_ERROR;
+				par_status_t 		bank_status	= ePAR_OK;
+				par_nvm_head_obj_t	head_obj	= {0};
+				uint8_t				bank		= 0U;
+				uint8_t				bank_sel	= 0U;
 
-		// Set signature
-		head_obj.sign = PAR_NVM_SIGN;
+				for ( bank = 0U; bank < PAR_NVM_BANK_NUM; bank++ )
+				{
+					gu8_par_nvm_bank = bank;
 
-		// Write num of object and CRC
-		if ( eNVM_OK != nvm_write( PAR_CFG_NVM_REGION, PAR_NVM_HEAD_ADDR, sizeof( par_nvm_head_obj_t ), (const uint8_t*) &head_obj ))
-		{
-			status = ePAR_ERROR_NVM;
-			PAR_DBG_PRINT( "PAR_NVM: NVM error during header write!" );
-		}
+					bank_status = par_nvm_validate_header( &head_obj );
 
-		PAR_DBG_PRINT( "PAR_NVM: Write NVM header with %d nb. of object", num_of_par );
+					// NVM error
+					if ( ePAR_ERROR_NVM == bank_status )
+					{
+						status = ePAR_ERROR_NVM;
+						break;
+					}
 
-		return status;
-	}
+					// Bank valid
+					else if ( ePAR_OK == bank_status )
+					{
+						// First valid or newer generation
+						if 	(	( ePAR_OK != status )
+							||	((int32_t)( head_obj.gen - p_head_obj->gen ) > 0 ))
+						{
+							*p_head_obj = head_obj;
+							bank_sel 	= bank;
+							status 		= ePAR_OK;
+						}
+					}
+					else
+					{
+						// No actions...
+					}
+				}
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Validate parameter NVM header
-	*
-	* @param[out]	p_num_of_par	- Pointer to number of persistent parameters that are stored in NVM
-	* @return		status 			- Status of operation
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	static par_status_t par_nvm_validate_header(uint16_t * const p_num_of_par)
-	{
-		par_status_t 		status 		= ePAR_OK;
-		par_nvm_head_obj_t 	obj_head	= { 0 };
-		uint16_t 			crc_calc	= 0;
+				// Use selected bank
+				gu8_par_nvm_bank = bank_sel;
+				gu32_par_nvm_gen = ( ePAR_OK == status ) ? p_head_obj->gen : 0UL;
 
-		// Read header
-		status = par_nvm_read_header( &obj_head );
+				PAR_DBG_PRINT( "PAR_NVM: Active bank: %d, generation: %d", gu8_par_nvm_bank, gu32_par_nvm_gen );
 
-		// NVM error
-		if ( ePAR_ERROR_NVM == status )
-		{
-			// No actions...
-		}
-		else
-		{
-			// Check for signature
-			if ( PAR_NVM_SIGN == obj_head.sign )
+				return status;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Carry over single bank NVM image into A/B banks
+			*
+			* @brief	When none of the banks is valid, NVM might still hold image
+			* 			stored without A/B banks (at bank A address). Its values are
+			* 			loaded and committed into bank B, leaving single bank image
+			* 			intact until next commit, thus power loss during migration
+			* 			only repeats it at next init.
+			*
+			* @param[in]	bank_status	- Status of bank selection
+			* @param[out]	p_head_obj	- Pointer to header of committed bank
+			* @return		status 		- Status of operation, "bank_status" if no single bank image
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_ab_migrate(const par_status_t bank_status, par_nvm_head_obj_t * const p_head_obj)
 			{
-				// Calculate CRC
-				crc_calc = par_nvm_calc_crc((uint8_t*) &obj_head.obj_nb, PAR_NVM_NB_OF_OBJ_SIZE );
+				par_status_t 		status 		= bank_status;
+				par_nvm_head_obj_t	head_obj	= {0};
+				par_nvm_load_t		load		= { .obj_addr = PAR_NVM_SINGLE_FIRST_DATA_OBJ_ADDR };
+
+				// Single bank image is at bank A
+				gu8_par_nvm_bank = 0U;
+				gu32_par_nvm_gen = 0UL;
 
-				// Validate CRC
-				if ( crc_calc == obj_head.crc )
+				if ( eNVM_OK != par_nvm_io_read( PAR_NVM_HEAD_ADDR, PAR_NVM_SINGLE_HEAD_SIZE, (uint8_t*) &head_obj ))
 				{
-					*p_num_of_par = obj_head.obj_nb;
-					PAR_DBG_PRINT( "PAR_NVM: HVM header OK! Nb. of stored obj: %d", obj_head.obj_nb );
+					status = ePAR_ERROR_NVM;
 				}
 
-				// CRC corrupt
+				// Valid single bank header
+				else if (	(	( PAR_NVM_SIGN_ACT == head_obj.sign )
+							||	( PAR_NVM_SIGN == head_obj.sign ))
+						&&	( par_nvm_calc_crc((const uint8_t*) &head_obj.obj_nb, PAR_NVM_NB_OF_OBJ_SIZE ) == head_obj.crc ))
+				{
+					status = ePAR_OK;
+
+					// Changed table is handled as invalid image
+					#if ( 1 == PAR_CFG_TABLE_ID_CHECK_EN )
+						status = par_nvm_check_table_id( PAR_NVM_SINGLE_HEAD_HASH_ADDR );
+					#endif
+
+					if ( ePAR_OK == status )
+					{
+						PAR_DBG_PRINT( "PAR_NVM: Single bank image found, migrating %d objects to A/B banks...", head_obj.obj_nb );
+
+						memset( g_par_nvm_data_obj_addr, 0, sizeof( g_par_nvm_data_obj_addr ));
+						load.obj_num = head_obj.obj_nb;
+
+						while (( ePAR_OK == status ) && ( load.obj_idx < load.obj_num ))
+						{
+							status = par_nvm_load_chunk( &load );
+						}
+
+						// Write loaded values to bank B
+						if ( ePAR_OK == status )
+						{
+							status = par_nvm_ab_commit();
+						}
+
+						// Continue with committed bank
+						if ( ePAR_OK == status )
+						{
+							status = par_nvm_ab_select_bank( p_head_obj );
+						}
+					}
+				}
 				else
 				{
-					status = ePAR_ERROR_CRC;
-					PAR_DBG_PRINT( "PAR_NVM: Header CRC corrupted!" );
+					// No actions...
 				}
+
+				PAR_DBG_PRINT( "PAR_NVM: Migration to A/B banks status: %s", par_get_status_str(status));
+
+				return status;
 			}
-			else
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Commit live values to inactive parameter NVM bank
+			*
+			* @brief	Signature of inactive bank is corrupted first, then all
+			* 			persistent parameters are written as consecutive data
+			* 			objects. Header with next generation is written as last,
+			* 			thus power loss at any point leaves previous bank active
+			* 			and valid.
+			*
+			* 			Only parameters written since last commit (or not stored
+			* 			in active bank jet) take live value, objects of the rest
+			* 			are copied from active bank. Thus value changed but not
+			* 			stored is not committed.
+			*
+			* @return		status 	- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_ab_commit(void)
 			{
-				status = ePAR_ERROR;
-				PAR_DBG_PRINT( "PAR_NVM: Signature corrupted!" );
+				par_status_t 		status 		= ePAR_OK;
+				const uint8_t		bank_prev	= gu8_par_nvm_bank;
+				const uint16_t		per_par_nb	= par_nvm_get_per_par();
+				uint8_t * const		p_buf		= (uint8_t*) &g_par_nvm_load_buf;
+				par_nvm_data_obj_t	obj_data	= { 0 };
+				uint32_t			obj_addr	= PAR_NVM_FIRST_DATA_OBJ_ADDR;
+				uint32_t			obj_size	= 0UL;
+				uint32_t			buf_pos		= 0UL;
+				uint32_t			par_addr	= 0UL;
+				par_num_t			par_num		= 0;
+				par_cfg_t			par_cfg		= {0};
+
+				// Stored values of not loaded parameters would be lost
+				#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+					if ( false == g_par_nvm_load.done )
+					{
+						(void) par_nvm_load_until( ePAR_NUM_OF );
+					}
+				#endif
+
+				// Size of NVM image
+				for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+				{
+					par_get_config( par_num, &par_cfg );
+
+					if ( true == par_cfg.persistant )
+					{
+						obj_size += ( PAR_NVM_DATA_OBJ_HEAD_SIZE + par_nvm_get_data_size( par_num ));
+					}
+				}
+
+				// Bank must hold all persistent parameters
+				if (( PAR_NVM_FIRST_DATA_OBJ_ADDR + obj_size ) > PAR_CFG_NVM_AB_BANK_SIZE )
+				{
+					status = ePAR_ERROR;
+					PAR_DBG_PRINT( "PAR_NVM: Bank too small for %d persistent parameters!", per_par_nb );
+				}
+				else
+				{
+					// Switch to inactive bank
+					gu8_par_nvm_bank = (( bank_prev + 1U ) % PAR_NVM_BANK_NUM );
+					gu32_par_nvm_gen++;
+
+					// Corrupt header (enter critical)
+					status = par_nvm_corrupt_signature();
+				}
+
+				PAR_ASSERT( ePAR_ERROR != status );
+
+				// Write objects in chunks of load buffer
+				for ( uint16_t pos = 0; ( pos < ePAR_NUM_OF ) && ( ePAR_OK == status ); pos++ )
+				{
+					par_num = PAR_NVM_OBJ_ORDER( pos );
+					par_get_config( par_num, &par_cfg );
+
+					if ( true == par_cfg.persistant )
+					{
+						// Written since last commit
+						if 	(	( 0UL != ( gu32_par_nvm_ab_pending[ par_num / 32U ] & ( 1UL << ( par_num % 32U ))))
+							||	( ePAR_OK != par_nvm_get_nvm_lut_addr( par_num, &par_addr )))
+						{
+							par_nvm_make_obj( par_num, &obj_data );
+						}
+
+						// Stored object from active bank
+						else
+						{
+							obj_data.size = par_nvm_get_data_size( par_num );
+
+							if ( eNVM_OK != par_nvm_io_read( ( PAR_NVM_BANK_ADDR( bank_prev ) + par_addr ), ( PAR_NVM_DATA_OBJ_HEAD_SIZE + obj_data.size ), (uint8_t*) &obj_data ))
+							{
+								status = ePAR_ERROR_NVM;
+								break;
+							}
+						}
+
+						obj_size = ( PAR_NVM_DATA_OBJ_HEAD_SIZE + obj_data.size );
+
+						// Buffer full
+						if (( buf_pos + obj_size ) > sizeof( g_par_nvm_load_buf ))
+						{
+							status = par_nvm_ab_write_chunk( obj_addr, buf_pos );
+							obj_addr += buf_pos;
+							buf_pos = 0UL;
+						}
+
+						memcpy( &p_buf[buf_pos], &obj_data, obj_size );
+						buf_pos += obj_size;
+					}
+				}
+
+				// Last chunk
+				if (( ePAR_OK == status ) && ( buf_pos > 0UL ))
+				{
+					status = par_nvm_ab_write_chunk( obj_addr, buf_pos );
+				}
+
+				// Re-write header (exit critical)
+				if ( ePAR_OK == status )
+				{
+					status = par_nvm_write_header( per_par_nb );
+				}
+
+				// Sync NVM
+				if ( ePAR_OK == status )
+				{
+					if ( eNVM_OK != par_nvm_io_sync())
+					{
+						status = ePAR_ERROR_NVM;
+					}
+				}
+
+				// Bank committed, objects of all persistent parameters are consecutive in it
+				if ( ePAR_OK == status )
+				{
+					memset( gu32_par_nvm_ab_pending, 0, sizeof( gu32_par_nvm_ab_pending ));
+					par_nvm_build_new_nvm_lut();
+				}
+
+				// Keep previous bank
+				else if ( bank_prev != gu8_par_nvm_bank )
+				{
+					gu8_par_nvm_bank = bank_prev;
+					gu32_par_nvm_gen--;
+				}
+
+				PAR_DBG_PRINT( "PAR_NVM: Bank %d commit with status: %s", (( bank_prev + 1U ) % PAR_NVM_BANK_NUM ), par_get_status_str(status));
+
+				return status;
 			}
-		}
 
-		return status;
-	}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Write chunk of data objects from load buffer to active bank
+			*
+			* @param[in]	obj_addr	- Address of first data object in chunk
+			* @param[in]	size		- Size of chunk
+			* @return		status 		- Status of operation
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static par_status_t par_nvm_ab_write_chunk(const uint32_t obj_addr, const uint32_t size)
+			{
+				par_status_t status = ePAR_OK;
+
+				if ( eNVM_OK != par_nvm_io_write( ( PAR_NVM_ACTIVE_BANK_ADDR + obj_addr ), size, (const uint8_t*) &g_par_nvm_load_buf ))
+				{
+					status = ePAR_ERROR_NVM;
+					PAR_DBG_PRINT( "PAR_NVM: NVM error during bank write!" );
+				}
+
+				return status;
+			}
+
+			////////////////////////////////////////////////////////////////////////////////
+			/**
+			*		Check if any parameter is written since last bank commit
+			*
+			* @return		is_pending	- True if bank commit is pending
+			*/
+			////////////////////////////////////////////////////////////////////////////////
+			static bool par_nvm_ab_is_pending(void)
+			{
+				bool is_pending = false;
+
+				for ( uint32_t word = 0; ( word < PAR_NVM_AB_PENDING_WORD_NUM ) && ( false == is_pending ); word++ )
+				{
+					is_pending = ( 0UL != gu32_par_nvm_ab_pending[word] );
+				}
+
+				return is_pending;
+			}
+		#endif // 1 == PAR_CFG_NVM_AB_EN
+
+	#endif // 0 == PAR_CFG_NVM_JOURNAL_EN
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Calculate CRC-16
+	*		Initialize NVM module
 	*
-	* @param[in]	p_data	- Pointer to data
-	* @param[in]	size	- Size of data to calc crc
-	* @return		crc16	- Calculated CRC
+	* @return		status - Status of operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-	static uint16_t par_nvm_calc_crc(const uint8_t * const p_data, const uint8_t size)
-	{
-		const 	uint16_t poly 	= 0x1021U;	// CRC-16-CCITT
-		const 	uint16_t seed 	= 0x1234U;	// Custom seed
-				uint16_t crc16 	= seed;
+    static par_status_t par_nvm_init_nvm(void)
+    {
+        par_status_t    status      = ePAR_OK;
+        bool            is_nvm_init = false;
+
+        // First check if NVM is already init
+        (void) nvm_is_init( &is_nvm_init );
+        
+        // NVM is not jet init
+        if ( false == is_nvm_init )
+        {
+            // Init NVM
+            if ( eNVM_OK != nvm_init())
+            {
+                status = ePAR_ERROR_INIT;
+                PAR_DBG_PRINT( "PAR_NVM: NVM module init error!" );  
+            }
+        }
+
+        return status;
+    }
+
+	#if ( 1 == PAR_CFG_NVM_JOURNAL_EN )
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Check that parameter table can be stored into journal
+		*
+		* @note		Sector must hold header and one record of each persistent
+		* 			parameter, otherwise compaction could not be done.
+		*
+		* @param[in]	per_par_nb	- Number of persistent parameters
+		* @return		status 		- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_jrnl_check_table(const uint16_t per_par_nb)
+		{
+			par_status_t 	status 		= ePAR_OK;
+			par_num_t		par_num		= 0;
+			par_cfg_t		par_cfg		= {0};
+
+			// Journal capacity
+			if (( sizeof( par_nvm_jrnl_head_t ) + ( per_par_nb * sizeof( par_nvm_data_obj_t ))) > PAR_CFG_NVM_JOURNAL_SECTOR_SIZE )
+			{
+				status = ePAR_ERROR;
+				PAR_DBG_PRINT( "PAR_NVM: Journal sector too small for %d persistent parameters!", per_par_nb );
+			}
+
+			// Reserved ID
+			for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+			{
+				par_get_config( par_num, &par_cfg );
+
+				if (( true == par_cfg.persistant ) && ( PAR_NVM_JRNL_ERASED_ID == par_cfg.id ))
+				{
+					status = ePAR_ERROR;
+					PAR_DBG_PRINT( "PAR_NVM: Parameter ID 0x%04X is reserved for journal!", par_cfg.id );
+				}
+			}
 
-		// Check input
-		PAR_ASSERT( NULL != p_data );
-		PAR_ASSERT( size > 0 );
+			PAR_ASSERT( ePAR_OK == status );
 
-	    for (uint8_t i = 0; i < size; i++)
-	    {
-	    	crc16 = ( crc16 ^ ( p_data[i] << 8U ));
+			return status;
+		}
 
-	        for (uint8_t j = 0U; j < 8U; j++)
-	        {
-	        	if (crc16 & 0x8000)
-	        	{
-	        		crc16 = (( crc16 << 1U ) ^ poly );
-	            }
-	        	else
-	            {
-	        		crc16 = ( crc16 << 1U );
-	            }
-	        }
-	    }
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Find active journal sector
+		*
+		* @brief	Both sector headers are read and sector with valid header and
+		* 			newer generation is selected. Generation comparison handles
+		* 			counter overflow.
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_jrnl_find_active(void)
+		{
+			par_status_t 		status 		= ePAR_ERROR;
+			par_nvm_jrnl_head_t	head		= {0};
+			uint8_t				sector		= 0U;
 
-		return crc16;
-	}
+			for ( sector = 0U; sector < PAR_NVM_JRNL_SECTOR_NUM; sector++ )
+			{
+				if ( eNVM_OK != par_nvm_io_read( PAR_NVM_JRNL_SECTOR_ADDR( sector ), sizeof( par_nvm_jrnl_head_t ), (uint8_t*) &head ))
+				{
+					status = ePAR_ERROR_NVM;
+					PAR_DBG_PRINT( "PAR_NVM: NVM error during journal header read!" );
+					break;
+				}
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Calculate parameter data object CRC
-	*
-	* @param[in]	p_obj	- Pointer to data object
-	* @return		crc16	- Calculated CRC
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	static uint8_t par_nvm_calc_obj_crc(const par_nvm_data_obj_t * const p_obj)
-	{
-		uint16_t 	crc 	= 0;
-		uint8_t 	rtn_crc = 0;
+				// Header valid
+				if 	(	( PAR_NVM_JRNL_SIGN == head.sign )
+					&&	( par_nvm_jrnl_calc_head_crc( &head ) == head.crc ))
+				{
+					// First valid or newer generation
+					if 	(	( ePAR_OK != status )
+						||	((int16_t)( head.gen - gu16_par_nvm_jrnl_gen ) > 0 ))
+					{
+						gu8_par_nvm_jrnl_sector = sector;
+						gu16_par_nvm_jrnl_gen	= head.gen;
+						status = ePAR_OK;
+					}
+				}
+			}
 
-		crc = par_nvm_calc_crc((const uint8_t*) &p_obj->id, 		2 );
-		crc ^= par_nvm_calc_crc((const uint8_t*) &p_obj->size, 		1 );
-		crc ^= par_nvm_calc_crc((const uint8_t*) &p_obj->data.u8, 	4 );
-		rtn_crc = ( crc & 0xFFU );
+			if ( ePAR_OK == status )
+			{
+				PAR_DBG_PRINT( "PAR_NVM: Journal active sector: %d, generation: %d", gu8_par_nvm_jrnl_sector, gu16_par_nvm_jrnl_gen );
+			}
+			else if ( ePAR_ERROR == status )
+			{
+				PAR_DBG_PRINT( "PAR_NVM: No valid journal sector!" );
+			}
+			else
+			{
+				// No actions...
+			}
 
-		return rtn_crc;
-	}
+			return status;
+		}
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Load all parameters value from NVM
-	*
-	* @param[in]	num_of_par	- Number of stored parameters inside NVM
-	* @return		status 		- Status of operation
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	static par_status_t par_nvm_load_all(const uint16_t num_of_par)
-	{
-		par_status_t 		status 		= ePAR_OK;
-		par_num_t 			par_num		= 0;
-		uint16_t			i			= 0;
-		uint16_t			obj_addr 	= 0;
-		par_nvm_data_obj_t	obj_data	= {0};
-		nvm_status_t		nvm_status	= eNVM_OK;
-		uint8_t				crc_calc	= 0;
-		uint16_t 			per_par_nb 	= 0;
-		par_cfg_t			par_cfg		= {0};
-		uint16_t 			new_par_cnt	= 0;
-
-		// Loop thru stored NVM object
-		for ( i = 0; i < num_of_par; i++ )
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Replay active journal sector
+		*
+		* @brief	Records are read in chunks of "PAR_CFG_NVM_LOAD_BUF_SIZE"
+		* 			bytes and applied in order of writing. First erased record
+		* 			marks end of journal. Records with corrupted CRC (e.g. power
+		* 			loss during write) are skipped.
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_jrnl_load(void)
 		{
-			// Calculate address
-			// NOTE: For know fixed 8 bytes!
-			obj_addr = (( 8 * i ) + PAR_NVM_FIRST_DATA_OBJ_ADDR );
+			par_status_t 	status 		= ePAR_OK;
+			uint32_t		offset		= sizeof( par_nvm_jrnl_head_t );
+			uint32_t		chunk_size	= 0UL;
+			uint32_t		j			= 0UL;
+			par_num_t 		par_num		= 0;
+			par_cfg_t		par_cfg		= {0};
+			bool			is_end		= false;
+
+			while (( offset < PAR_CFG_NVM_JOURNAL_SECTOR_SIZE ) && ( false == is_end ))
+			{
+				// Size of chunk
+				chunk_size = PAR_CFG_NVM_JOURNAL_SECTOR_SIZE - offset;
 
-			// Load parameter NVM object
-			nvm_status = nvm_read( PAR_CFG_NVM_REGION, obj_addr, sizeof( par_nvm_data_obj_t ), (uint8_t*) &obj_data );
+				if ( chunk_size > sizeof( g_par_nvm_load_buf ))
+				{
+					chunk_size = sizeof( g_par_nvm_load_buf );
+				}
 
-			// NVM read OK
-			if ( eNVM_OK == nvm_status )
-			{
-				// Calculate CRC
-				crc_calc = par_nvm_calc_obj_crc( &obj_data );
+				// Load chunk of records
+				if ( eNVM_OK != par_nvm_io_read( ( PAR_NVM_JRNL_SECTOR_ADDR( gu8_par_nvm_jrnl_sector ) + offset ), chunk_size, (uint8_t*) &g_par_nvm_load_buf ))
+				{
+					status = ePAR_ERROR_NVM;
+					break;
+				}
 
-				// CRC OK
-				if ( crc_calc == obj_data.crc )
+				// Apply records from chunk
+				for ( j = 0UL; j < ( chunk_size / sizeof( par_nvm_data_obj_t )); j++ )
 				{
-					// Is that parameter in current table
-					if ( ePAR_OK == par_get_num_by_id( obj_data.id, &par_num ))
+					// End of journal
+					if ( true == par_nvm_jrnl_is_erased( &g_par_nvm_load_buf[j] ))
+					{
+						is_end = true;
+						break;
+					}
+
+					// CRC OK and parameter in current table
+					if 	(	( true == par_nvm_check_obj( &g_par_nvm_load_buf[j] ))
+						&&	( ePAR_OK == par_get_num_by_id( g_par_nvm_load_buf[j].id, &par_num )))
 					{
 						par_get_config( par_num, &par_cfg );
 
-						/**
-						 * 	Parameter found in device and stored in NVM
-						 *
-						 * 	Check if that parameter is still persistent!
-						 */
+						// Still persistent
 						if ( true == par_cfg.persistant )
 						{
-							// Check if already in LUT
-							if ( false == par_nvm_is_in_nvm_lut( obj_data.id ))
-							{
-								// Add to NVM lut
-								g_par_nvm_data_obj_addr[per_par_nb].id 		= obj_data.id;
-								g_par_nvm_data_obj_addr[per_par_nb].addr 	= obj_addr;
-								g_par_nvm_data_obj_addr[per_par_nb].valid 	= true;
-
-                                // Set parameter
-								par_set( par_num, &obj_data.data );
-
-								// Increment current persistent parameter counter
-								per_par_nb++;
-							}
+							par_set( par_num, g_par_nvm_load_buf[j].data );
 						}
 					}
 
-					// Parameter not in current table
-					else
-					{
-						// No action...
-					}
+					offset += sizeof( par_nvm_data_obj_t );
 				}
+			}
 
-				// CRC corrupted
-				else
+			// First free record
+			gu32_par_nvm_jrnl_wr_offset = offset;
+
+			PAR_DBG_PRINT( "PAR_NVM: Journal replay with status: %s", par_get_status_str(status));
+			PAR_DBG_PRINT( "PAR_NVM: Journal used: %d/%d bytes", offset, PAR_CFG_NVM_JOURNAL_SECTOR_SIZE );
+
+			return status;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Append record to active journal sector
+		*
+		* @note		Write offset is moved also in case of NVM error as record
+		* 			slot might be partially written.
+		*
+		* @param[in]	p_obj	- Pointer to data object
+		* @return		status 	- Status of operation, ePAR_ERROR if sector is full
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_jrnl_append(const par_nvm_data_obj_t * const p_obj)
+		{
+			par_status_t status = ePAR_OK;
+
+			if (( gu32_par_nvm_jrnl_wr_offset + sizeof( par_nvm_data_obj_t )) <= PAR_CFG_NVM_JOURNAL_SECTOR_SIZE )
+			{
+				if ( eNVM_OK != par_nvm_io_write( ( PAR_NVM_JRNL_SECTOR_ADDR( gu8_par_nvm_jrnl_sector ) + gu32_par_nvm_jrnl_wr_offset ), sizeof( par_nvm_data_obj_t ), (const uint8_t*) p_obj ))
 				{
-					status = ePAR_ERROR_CRC;
-					break;
+					status = ePAR_ERROR_NVM;
+					PAR_DBG_PRINT( "PAR_NVM: NVM error during journal append!" );
 				}
+
+				gu32_par_nvm_jrnl_wr_offset += sizeof( par_nvm_data_obj_t );
 			}
 			else
 			{
-				status = ePAR_ERROR_NVM;
-				break;
+				status = ePAR_ERROR;
 			}
-		}
 
-		PAR_DBG_PRINT( "PAR_NVM: Loading all persistent parameters with status: %s", par_get_status_str(status));
-		PAR_DBG_PRINT( "PAR_NVM: Nb. of stored pars in NVM: %d", num_of_par );
-		PAR_DBG_PRINT( "PAR_NVM: Nb. of live persistent: \t%d", par_nvm_get_per_par());
+			return status;
+		}
 
-		// Find new persistent parameter
-		if ( ePAR_OK == status )
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Compact journal into spare sector
+		*
+		* @brief	Spare sector is erased and one record with live value of each
+		* 			persistent parameter is written into it. Header with next
+		* 			generation is written as last, thus power loss during
+		* 			compaction leaves previous sector active.
+		*
+		* @note		This is the only place where journal sector is erased.
+		*
+		* 			Live values of parameters that were only set are stored as
+		* 			well, as journal keeps no address of their latest record.
+		* 			Therefore all parameters are marked as stored first.
+		*
+		* @return		status 	- Status of operation
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static par_status_t par_nvm_jrnl_compact(void)
 		{
-			for ( i = 0; i < ePAR_NUM_OF; i++ )
+			par_status_t 		status 		= ePAR_OK;
+			par_nvm_jrnl_head_t	head		= {0};
+			const uint8_t		sector		= (( gu8_par_nvm_jrnl_sector + 1U ) % PAR_NVM_JRNL_SECTOR_NUM );
+			const uint32_t		sector_addr	= PAR_NVM_JRNL_SECTOR_ADDR( sector );
+			uint32_t			offset		= sizeof( par_nvm_jrnl_head_t );
+			uint32_t			buf_num		= 0UL;
+			par_num_t			par_num		= 0;
+			par_cfg_t			par_cfg		= {0};
+
+			// Live values of all parameters are stored
+			par_set_stored_all();
+
+			// Erase spare sector
+			if ( eNVM_OK != par_nvm_io_erase( sector_addr, PAR_CFG_NVM_JOURNAL_SECTOR_SIZE ))
 			{
-				par_get_config( i, &par_cfg );
+				status = ePAR_ERROR_NVM;
+			}
+
+			// Write live values in chunks of load buffer
+			for ( par_num = 0; ( par_num < ePAR_NUM_OF ) && ( ePAR_OK == status ); par_num++ )
+			{
+				par_get_config( par_num, &par_cfg );
 
 				if ( true == par_cfg.persistant )
 				{
-					if ( false == par_nvm_is_in_nvm_lut( par_cfg.id ))
-					{
-						// Is persistant and not jet in NVM lut -> Add to LUT
-						g_par_nvm_data_obj_addr[per_par_nb].id 		= par_cfg.id;
-						g_par_nvm_data_obj_addr[per_par_nb].addr 	= obj_addr + ( 8 * ( new_par_cnt + 1 ));
-						g_par_nvm_data_obj_addr[per_par_nb].valid 	= true;
-
-						// Write new par to NVM
-						par_save( i );
+					par_nvm_make_obj( par_num, &g_par_nvm_load_buf[buf_num] );
+					buf_num++;
+				}
 
-						per_par_nb++;
-						new_par_cnt++;
+				// Buffer full or last parameter
+				if 	(	( buf_num > 0UL )
+					&&	(	( PAR_NVM_LOAD_BUF_OBJ_NUM == buf_num )
+						||	(( ePAR_NUM_OF - 1 ) == par_num )))
+				{
+					if ( eNVM_OK != par_nvm_io_write( ( sector_addr + offset ), ( buf_num * sizeof( par_nvm_data_obj_t )), (const uint8_t*) &g_par_nvm_load_buf ))
+					{
+						status = ePAR_ERROR_NVM;
 					}
+
+					offset += ( buf_num * sizeof( par_nvm_data_obj_t ));
+					buf_num = 0UL;
 				}
 			}
 
-			// If there is a new persistent parameter change HVM header
-			if ( new_par_cnt > 0 )
+			// Commit sector by writing header
+			if ( ePAR_OK == status )
 			{
-				// Add additional new persistent parameters number to existing one!
-				// NOTE: In general obj number will only rise!
-				status |= par_nvm_write_header( num_of_par + new_par_cnt );
+				head.sign 	= PAR_NVM_JRNL_SIGN;
+				head.gen	= (uint16_t)( gu16_par_nvm_jrnl_gen + 1U );
+				head.crc	= par_nvm_jrnl_calc_head_crc( &head );
 
-                // Sync NVM
-                status |= par_nvm_sync();
+				if ( eNVM_OK != par_nvm_io_write( sector_addr, sizeof( par_nvm_jrnl_head_t ), (const uint8_t*) &head ))
+				{
+					status = ePAR_ERROR_NVM;
+				}
 
-				#if ( PAR_CFG_DEBUG_EN )
-					PAR_DBG_PRINT( "PAR_NVM: Added %d new parameters to NVM LUT table!", new_par_cnt );
-				#endif
+				status |= par_nvm_sync();
 			}
-		}
-
-		return status;
-	}
-
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Get total number of persistent parameters
-	*
-	* @return	num_of_per_par - Number of persistent parameters
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	static uint16_t	par_nvm_get_per_par(void)
-	{
-		uint16_t 	num_of_per_par 	= 0UL;
-		uint16_t 	par_num 		= 0UL;
-		par_cfg_t	par_cfg			= {0};
-
-		for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
-		{
-			par_get_config( par_num, &par_cfg );
 
-			if ( true == par_cfg.persistant )
+			// Switch to new sector
+			if ( ePAR_OK == status )
 			{
-				num_of_per_par++;
+				gu8_par_nvm_jrnl_sector 	= sector;
+				gu16_par_nvm_jrnl_gen		= head.gen;
+				gu32_par_nvm_jrnl_wr_offset	= offset;
 			}
+
+			PAR_DBG_PRINT( "PAR_NVM: Journal compaction to sector %d with status: %s", sector, par_get_status_str(status));
+
+			return status;
 		}
 
-		return num_of_per_par;
-	}
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Calculate journal sector header CRC
+		*
+		* @param[in]	p_head	- Pointer to journal header
+		* @return		crc16	- Calculated CRC
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static uint16_t par_nvm_jrnl_calc_head_crc(const par_nvm_jrnl_head_t * const p_head)
+		{
+			uint16_t crc = 0;
 
-	////////////////////////////////////////////////////////////////////////////////
-	/**
-	*		Build new parameter NVM LUT table
-	*
-	* @return	void
-	*/
-	////////////////////////////////////////////////////////////////////////////////
-	static void par_nvm_build_new_nvm_lut(void)
-	{
-		uint16_t 		per_par_nb 			= 0;
-		par_num_t		par_num				= 0;
-		par_cfg_t		par_cfg				= {0};
+			crc = par_nvm_calc_crc((const uint8_t*) &p_head->sign, 	4 );
+			crc ^= par_nvm_calc_crc((const uint8_t*) &p_head->gen, 	2 );
 
-		// Loop thru all parameters
-		for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
+			return crc;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/**
+		*		Check if journal record slot is erased
+		*
+		* @param[in]	p_obj		- Pointer to data object
+		* @return		is_erased	- Flag that indicates free record slot
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static bool par_nvm_jrnl_is_erased(const par_nvm_data_obj_t * const p_obj)
 		{
-			par_get_config( par_num, &par_cfg );
+			const uint8_t * const 	p_byte 		= (const uint8_t*) p_obj;
+			bool					is_erased	= true;
+			uint8_t					i			= 0U;
 
-			if ( true == par_cfg.persistant )
+			for ( i = 0U; i < sizeof( par_nvm_data_obj_t ); i++ )
 			{
-				// First parameter
-				if ( 0 == per_par_nb )
-				{
-					g_par_nvm_data_obj_addr[per_par_nb].addr = PAR_NVM_FIRST_DATA_OBJ_ADDR;
-				}
-
-				// Build consecutive address space
-				// NOTE: For know each NVM data object is fixed in size (8 bytes)
-				else
+				if ( 0xFFU != p_byte[i] )
 				{
-					// Calculate and add address of next parameter
-					g_par_nvm_data_obj_addr[per_par_nb].addr = ( g_par_nvm_data_obj_addr[per_par_nb-1].addr + 8 );
+					is_erased = false;
+					break;
 				}
-
-				// Store parameter ID
-				g_par_nvm_data_obj_addr[per_par_nb].id = par_cfg.id;
-
-				// Next persistent parameter
-				per_par_nb++;
 			}
+
+			return is_erased;
 		}
-        
-        // Show NVM LUT table
-		par_nvm_print_nvm_lut();
-	}
+
+	#endif // 1 == PAR_CFG_NVM_JOURNAL_EN
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Get parameter NVM object start address based on its ID
+	*		Read from parameters NVM region
 	*
-	* @note		In case ID is not found there is a problem with building the
-	* 			NVM lut!!!
+	* @note		All NVM accesses of module go thru "par_nvm_io_*" functions,
+	* 			so that they are counted in one place.
 	*
-	* @param[in]	id			- Parameter ID
-	* @return		obj_addr	- NVM address of object with ID
+	* @param[in]	addr	- Address inside NVM region
+	* @param[in]	size	- Size of data in bytes
+	* @param[out]	p_data	- Pointer to read data
+	* @return		status	- Status of NVM operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-	static uint16_t par_nvm_get_nvm_lut_addr(const uint16_t id)
+	static nvm_status_t par_nvm_io_read(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
 	{
-		uint16_t	obj_addr	= 0;
-		par_num_t	par_num		= 0;
-
-		for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
-		{
-			if ( id == g_par_nvm_data_obj_addr[par_num].id )
-			{
-				obj_addr = g_par_nvm_data_obj_addr[par_num].addr;
-				break;
-			}
-		}
-
-        // ZIGA: TODO: Validate if address is found correctly!!!
+		#if ( 1 == PAR_CFG_STATS_EN )
+			g_par_nvm_stats.rd_cnt++;
+			g_par_nvm_stats.rd_bytes += size;
+		#endif
 
-		return obj_addr;
+		return nvm_read( PAR_CFG_NVM_REGION, addr, size, p_data );
 	}
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Check if parameter is in NVM LUT
+	*		Write to parameters NVM region
 	*
-	* @param[in]	id			- Parameter ID
-	* @return		is_in_lut	- Flag that indicated if object is in NVM lut
+	* @param[in]	addr	- Address inside NVM region
+	* @param[in]	size	- Size of data in bytes
+	* @param[in]	p_data	- Pointer to data to write
+	* @return		status	- Status of NVM operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-	static bool	par_nvm_is_in_nvm_lut(const uint16_t id )
+	static nvm_status_t par_nvm_io_write(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
 	{
-		bool 		is_in_lut 	= false;
-		par_num_t	par_num		= 0;
-
-		for ( par_num = 0; par_num < ePAR_NUM_OF; par_num++ )
-		{
-			if 	(	( id == g_par_nvm_data_obj_addr[par_num].id )
-				&& 	( true == g_par_nvm_data_obj_addr[par_num].valid ))
-			{
-				is_in_lut = true;
-				break;
-			}
-		}
+		#if ( 1 == PAR_CFG_STATS_EN )
+			g_par_nvm_stats.wr_cnt++;
+			g_par_nvm_stats.wr_bytes += size;
+		#endif
 
-		return is_in_lut;
+		return nvm_write( PAR_CFG_NVM_REGION, addr, size, p_data );
 	}
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Initialize NVM module
+	*		Erase part of parameters NVM region
 	*
-	* @return		status - Status of operation
+	* @param[in]	addr	- Address inside NVM region
+	* @param[in]	size	- Size of erased area in bytes
+	* @return		status	- Status of NVM operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-    static par_status_t par_nvm_init_nvm(void)
-    {
-        par_status_t    status      = ePAR_OK;
-        bool            is_nvm_init = false;
-
-        // First check if NVM is already init
-        (void) nvm_is_init( &is_nvm_init );
-        
-        // NVM is not jet init
-        if ( false == is_nvm_init )
-        {
-            // Init NVM
-            if ( eNVM_OK != nvm_init())
-            {
-                status = ePAR_ERROR_INIT;
-                PAR_DBG_PRINT( "PAR_NVM: NVM module init error!" );  
-            }
-        }
+	static nvm_status_t par_nvm_io_erase(const uint32_t addr, const uint32_t size)
+	{
+		#if ( 1 == PAR_CFG_STATS_EN )
+			g_par_nvm_stats.erase_cnt++;
+		#endif
 
-        return status;
-    }
+		return nvm_erase( PAR_CFG_NVM_REGION, addr, size );
+	}
 
-    ////////////////////////////////////////////////////////////////////////////////
+	////////////////////////////////////////////////////////////////////////////////
 	/**
-	*		Sync NVM module
+	*		Sync parameters NVM region
 	*
-	* @return		status - Status of operation
+	* @return		status	- Status of NVM operation
 	*/
 	////////////////////////////////////////////////////////////////////////////////
-    static par_status_t par_nvm_sync(void)
-    {
-        par_status_t status = ePAR_OK;
-
-        if ( eNVM_OK != nvm_sync( PAR_CFG_NVM_REGION ))
-        {
-            status = ePAR_ERROR_NVM;
-        }
-
-        return status;       
-    }
+	static nvm_status_t par_nvm_io_sync(void)
+	{
+		#if ( 1 == PAR_CFG_STATS_EN )
+			g_par_nvm_stats.sync_cnt++;
+		#endif
 
+		return nvm_sync( PAR_CFG_NVM_REGION );
+	}
 
 	////////////////////////////////////////////////////////////////////////////////
 	/**
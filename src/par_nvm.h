@@ -35,8 +35,37 @@
 	par_status_t par_nvm_deinit         (void);
 	par_status_t par_nvm_write          (const par_num_t par_num, const bool nvm_sync);
 	par_status_t par_nvm_write_all      (void);
+	par_status_t par_nvm_sync           (void);
 	par_status_t par_nvm_reset_all      (void);
 	par_status_t par_nvm_print_nvm_lut  (void);
+	void		 par_nvm_get_mem_usage	(par_mem_usage_t * const p_usage);
+
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		par_status_t par_nvm_load_hndl		(void);
+		par_status_t par_nvm_load			(const par_num_t par_num);
+	#endif
+
+	#if ( 1 == PAR_CFG_PROFILE_EN )
+		par_status_t par_nvm_profile_write	(const uint8_t profile, const par_profile_t * const p_profile);
+		par_status_t par_nvm_profile_read	(const uint8_t profile, par_profile_t * const p_profile);
+	#endif
+
+	#if ( 1 == PAR_CFG_STATS_EN )
+		void par_nvm_get_stats				(par_stats_nvm_t * const p_stats);
+		void par_nvm_clear_stats			(void);
+	#endif
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Internal hooks implemented by parameters module, used only by NVM module
+	////////////////////////////////////////////////////////////////////////////////
+	#if ( 1 == PAR_CFG_NVM_LAZY_EN )
+		par_status_t par_set_loaded			(const par_num_t par_num, const void * p_val, const bool is_final);
+		par_status_t par_set_loaded_all		(void);
+	#endif
+
+	#if ( 1 == PAR_CFG_NVM_JOURNAL_EN )
+		void		 par_set_stored_all		(void);
+	#endif
 
 #endif // 1 == PAR_CFG_NVM_EN
 
@@ -0,0 +1,521 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_ser.c
+*@brief     Parameter binary serialization
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_SER
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Parameter binary serialization.
+*
+* @brief	This module encodes parameter values into compact binary frame and
+* 			applies values from such frame, so that host can push or pull
+* 			complete configuration in single transfer.
+*
+* 			Frame layout:
+*
+* 			| flags (1) | record 0 | record 1 | ... |
+*
+* 			Record layout:
+*
+* 			| ID (2) | type (1) | value (n) | min (n) | max (n) | def (n) |
+*
+* 			where "n" is size of parameter data type and min/max are present
+* 			only with "PAR_SER_FLAG_RANGE" flag, def with "PAR_SER_FLAG_DEF"
+* 			flag. All fields are in little endianness format.
+*
+* @note		Decoded values are applied with "par_set_batch()", thus clamped
+* 			the same way as with "par_set()". Values are not stored to NVM.
+*
+* 			Array parameters are not supported, their records are skipped.
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "par_ser.h"
+#include "../../par_cfg.h"
+
+#if ( 1 == PAR_CFG_SER_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Definitions
+	////////////////////////////////////////////////////////////////////////////////
+
+	/**
+	 * 	Frame header size
+	 *
+	 * 	Unit: byte
+	 */
+	#define PAR_SER_HEAD_SIZE					( 1UL )
+
+	/**
+	 * 	Record size without value fields
+	 *
+	 * 	Unit: byte
+	 */
+	#define PAR_SER_REC_HEAD_SIZE				( 3UL )
+
+	/**
+	 * 	All supported frame flags
+	 */
+	#define PAR_SER_FLAG_ALL					( PAR_SER_FLAG_RANGE | PAR_SER_FLAG_DEF )
+
+	/**
+	 * 	Raw value used for endianness conversion
+	 */
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		typedef uint64_t par_ser_raw_t;
+	#else
+		typedef uint32_t par_ser_raw_t;
+	#endif
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Function Prototypes
+	////////////////////////////////////////////////////////////////////////////////
+	static uint32_t		par_ser_get_val_num		(const uint8_t flags);
+	static par_status_t	par_ser_encode_one		(const par_num_t par_num, const uint8_t flags, uint8_t * const p_buf, const uint32_t size, uint32_t * const p_pos);
+	static void			par_ser_put_val			(uint8_t * const p_buf, const par_type_t * const p_val, const uint8_t val_size);
+	static void			par_ser_get_val			(const uint8_t * const p_buf, par_type_t * const p_val, const uint8_t val_size);
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Functions
+	////////////////////////////////////////////////////////////////////////////////
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Encode set of parameters into binary frame
+	*
+	* @note		Values are read one by one, thus frame is not consistent snapshot
+	* 			of all values in case of concurrent writes.
+	*
+	* @param[in]	p_par_num	- Pointer to parameter numbers (enumerations)
+	* @param[in]	num			- Number of parameters
+	* @param[in]	flags		- Optional fields, see "PAR_SER_FLAG_*"
+	* @param[out]	p_buf		- Pointer to frame buffer
+	* @param[in]	size		- Size of frame buffer in bytes
+	* @param[out]	p_len		- Pointer to frame length in bytes
+	* @return		status 		- Status of operation, ePAR_ERROR if frame does not fit
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_ser_encode(const par_num_t * const p_par_num, const uint32_t num, const uint8_t flags, uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len)
+	{
+		par_status_t 	status 	= ePAR_OK;
+		uint32_t		pos		= PAR_SER_HEAD_SIZE;
+
+		PAR_ASSERT(( NULL != p_par_num ) || ( 0UL == num ));
+		PAR_ASSERT(( NULL != p_buf ) && ( NULL != p_len ));
+		PAR_ASSERT( 0U == ( flags & ~PAR_SER_FLAG_ALL ));
+
+		if 	(	(( NULL == p_par_num ) && ( 0UL != num ))
+			||	( NULL == p_buf )
+			||	( NULL == p_len )
+			||	( size < PAR_SER_HEAD_SIZE )
+			||	( 0U != ( flags & ~PAR_SER_FLAG_ALL )))
+		{
+			status = ePAR_ERROR;
+		}
+		else
+		{
+			p_buf[0] = flags;
+
+			for ( uint32_t i = 0; ( i < num ) && ( ePAR_OK == status ); i++ )
+			{
+				status = par_ser_encode_one( p_par_num[i], flags, p_buf, size, &pos );
+			}
+
+			*p_len = ( ePAR_OK == status ) ? pos : 0UL;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Encode range of parameters into binary frame
+	*
+	* @param[in]	par_num_first	- First parameter number (enumeration) of range
+	* @param[in]	num				- Number of parameters in range
+	* @param[in]	flags			- Optional fields, see "PAR_SER_FLAG_*"
+	* @param[out]	p_buf			- Pointer to frame buffer
+	* @param[in]	size			- Size of frame buffer in bytes
+	* @param[out]	p_len			- Pointer to frame length in bytes
+	* @return		status 			- Status of operation, ePAR_ERROR if frame does not fit
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_ser_encode_range(const par_num_t par_num_first, const uint32_t num, const uint8_t flags, uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len)
+	{
+		par_status_t 	status 	= ePAR_OK;
+		uint32_t		pos		= PAR_SER_HEAD_SIZE;
+
+		PAR_ASSERT(( num <= ePAR_NUM_OF ) && ( par_num_first <= ( ePAR_NUM_OF - num )));
+		PAR_ASSERT(( NULL != p_buf ) && ( NULL != p_len ));
+		PAR_ASSERT( 0U == ( flags & ~PAR_SER_FLAG_ALL ));
+
+		if 	(	( num > ePAR_NUM_OF )
+			||	( par_num_first > ( ePAR_NUM_OF - num ))
+			||	( NULL == p_buf )
+			||	( NULL == p_len )
+			||	( size < PAR_SER_HEAD_SIZE )
+			||	( 0U != ( flags & ~PAR_SER_FLAG_ALL )))
+		{
+			status = ePAR_ERROR;
+		}
+		else
+		{
+			p_buf[0] = flags;
+
+			for ( uint32_t i = 0; ( i < num ) && ( ePAR_OK == status ); i++ )
+			{
+				status = par_ser_encode_one((par_num_t)( par_num_first + i ), flags, p_buf, size, &pos );
+			}
+
+			*p_len = ( ePAR_OK == status ) ? pos : 0UL;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Decode binary frame and apply parameter values
+	*
+	* @brief	Whole frame is validated first and then all records are
+	* 			applied with single "par_set_batch()", thus either all values
+	* 			of frame are set or none of them. Frame with unknown parameter,
+	* 			data type different from configuration, array parameter or
+	* 			with more than "PAR_CFG_SER_DECODE_NUM" records is rejected.
+	*
+	* 			Records of read only parameters (ePAR_ACCESS_RO) are skipped
+	* 			and counted as rejected, rest of frame is still applied.
+	*
+	* 			Optional fields (range, default) are ignored.
+	*
+	* @param[in]	p_buf	- Pointer to frame
+	* @param[in]	len		- Frame length in bytes
+	* @param[out]	p_num	- Pointer to number of applied parameters, can be NULL
+	* @param[out]	p_rej	- Pointer to number of rejected read only parameters, can be NULL
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_ser_decode(const uint8_t * const p_buf, const uint32_t len, uint32_t * const p_num, uint32_t * const p_rej)
+	{
+		par_status_t 	status 		= ePAR_OK;
+		uint32_t		pos			= PAR_SER_HEAD_SIZE;
+		uint32_t		rec_size	= 0UL;
+		uint32_t		rec_num		= 0UL;
+		uint32_t		applied		= 0UL;
+		uint32_t		rejected	= 0UL;
+		uint32_t		val_num		= 0UL;
+		uint16_t		id			= 0U;
+		uint16_t		par_len		= 0U;
+		uint8_t			type		= 0U;
+		uint8_t			val_size	= 0U;
+		par_type_list_t	par_type	= ePAR_TYPE_U8;
+		par_cfg_t		par_cfg		= { 0 };
+		par_num_t		par_num[ PAR_CFG_SER_DECODE_NUM ];
+		par_type_t		val[ PAR_CFG_SER_DECODE_NUM ];
+		const void *	p_val[ PAR_CFG_SER_DECODE_NUM ];
+
+		PAR_ASSERT( NULL != p_buf );
+
+		if 	(	( NULL == p_buf )
+			||	( len < PAR_SER_HEAD_SIZE )
+			||	( 0U != ( p_buf[0] & ~PAR_SER_FLAG_ALL )))
+		{
+			status = ePAR_ERROR;
+		}
+		else
+		{
+			val_num = par_ser_get_val_num( p_buf[0] );
+
+			// Validate and collect all records
+			while (( pos + PAR_SER_REC_HEAD_SIZE ) <= len )
+			{
+				id 		= (uint16_t)( p_buf[pos] | ( p_buf[ pos + 1UL ] << 8U ));
+				type 	= p_buf[ pos + 2UL ];
+
+				// Unknown type, size of record is unknown
+				if 	(	( type >= ePAR_TYPE_NUM_OF )
+					||	( ePAR_OK != par_get_type_size((par_type_list_t) type, &val_size )))
+				{
+					status |= ePAR_ERROR;
+					break;
+				}
+
+				rec_size = PAR_SER_REC_HEAD_SIZE + ( val_num * val_size );
+
+				// Truncated record
+				if (( pos + rec_size ) > len )
+				{
+					status |= ePAR_ERROR;
+					break;
+				}
+
+				// Known parameter with matching type
+				if 	(	( rec_num < PAR_CFG_SER_DECODE_NUM )
+					&&	( ePAR_OK == par_get_num_by_id( id, &par_num[rec_num] ))
+					&&	( ePAR_OK == par_get_type( par_num[rec_num], &par_type ))
+					&&	( par_type == type )
+					&&	( ePAR_OK == par_get_len( par_num[rec_num], &par_len ))
+					&&	( 1U == par_len )
+					&&	( ePAR_OK == par_get_config( par_num[rec_num], &par_cfg )))
+				{
+					// Not writable from external device
+					if ( ePAR_ACCESS_RO == par_cfg.access )
+					{
+						rejected++;
+						PAR_DBG_PRINT( "PAR_SER: Record of read only par ID %d rejected!", id );
+					}
+					else
+					{
+						par_ser_get_val( &p_buf[ pos + PAR_SER_REC_HEAD_SIZE ], &val[rec_num], val_size );
+						p_val[rec_num] = &val[rec_num];
+						rec_num++;
+					}
+				}
+				else
+				{
+					status |= ePAR_ERROR;
+					PAR_DBG_PRINT( "PAR_SER: Frame rejected at record of par ID %d!", id );
+					break;
+				}
+
+				pos += rec_size;
+			}
+
+			// Trailing bytes
+			if ( pos != len )
+			{
+				status |= ePAR_ERROR;
+			}
+
+			// Apply all or none
+			if (( ePAR_OK == status ) && ( rec_num > 0UL ))
+			{
+				status = par_set_batch( par_num, p_val, rec_num );
+
+				if ( ePAR_OK == status )
+				{
+					applied = rec_num;
+				}
+			}
+		}
+
+		if ( NULL != p_num )
+		{
+			*p_num = applied;
+		}
+
+		if ( NULL != p_rej )
+		{
+			*p_rej = rejected;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get number of value fields in record
+	*
+	* @param[in]	flags	- Frame flags
+	* @return		val_num	- Number of value fields
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint32_t par_ser_get_val_num(const uint8_t flags)
+	{
+		uint32_t val_num = 1UL;
+
+		if ( 0U != ( flags & PAR_SER_FLAG_RANGE ))
+		{
+			val_num += 2UL;
+		}
+
+		if ( 0U != ( flags & PAR_SER_FLAG_DEF ))
+		{
+			val_num += 1UL;
+		}
+
+		return val_num;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Encode single parameter record
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @param[in]	flags	- Optional fields, see "PAR_SER_FLAG_*"
+	* @param[out]	p_buf	- Pointer to frame buffer
+	* @param[in]	size	- Size of frame buffer in bytes
+	* @param[in,out]p_pos	- Pointer to write position inside frame
+	* @return		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static par_status_t par_ser_encode_one(const par_num_t par_num, const uint8_t flags, uint8_t * const p_buf, const uint32_t size, uint32_t * const p_pos)
+	{
+		par_status_t 	status 		= ePAR_OK;
+		uint32_t		pos			= *p_pos;
+		uint8_t			val_size	= 0U;
+		par_cfg_t		par_cfg		= { 0 };
+		par_type_t		val			= { 0 };
+
+		status |= par_get_config( par_num, &par_cfg );
+		status |= par_get_type_size( par_cfg.type, &val_size );
+
+		if ( ePAR_OK != status )
+		{
+			// No actions...
+		}
+
+		// Array parameters are not supported
+		#if ( 1 == PAR_CFG_ARRAY_EN )
+			else if ( par_cfg.len > 1U )
+			{
+				status = ePAR_ERROR;
+				PAR_DBG_PRINT( "PAR_SER: Array parameter %d can not be encoded!", par_num );
+			}
+		#endif
+
+		// Record does not fit
+		else if (( pos + PAR_SER_REC_HEAD_SIZE + ( par_ser_get_val_num( flags ) * val_size )) > size )
+		{
+			status = ePAR_ERROR;
+			PAR_DBG_PRINT( "PAR_SER: Frame buffer too small!" );
+		}
+		else
+		{
+			status = par_get( par_num, &val );
+
+			p_buf[ pos + 0UL ] = (uint8_t)( par_cfg.id & 0xFFU );
+			p_buf[ pos + 1UL ] = (uint8_t)( par_cfg.id >> 8U );
+			p_buf[ pos + 2UL ] = (uint8_t) par_cfg.type;
+			pos += PAR_SER_REC_HEAD_SIZE;
+
+			par_ser_put_val( &p_buf[pos], &val, val_size );
+			pos += val_size;
+
+			if ( 0U != ( flags & PAR_SER_FLAG_RANGE ))
+			{
+				par_ser_put_val( &p_buf[pos], &par_cfg.min, val_size );
+				pos += val_size;
+
+				par_ser_put_val( &p_buf[pos], &par_cfg.max, val_size );
+				pos += val_size;
+			}
+
+			if ( 0U != ( flags & PAR_SER_FLAG_DEF ))
+			{
+				par_ser_put_val( &p_buf[pos], &par_cfg.def, val_size );
+				pos += val_size;
+			}
+
+			*p_pos = pos;
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Put value into frame in little endianness format
+	*
+	* @param[out]	p_buf		- Pointer to frame buffer
+	* @param[in]	p_val		- Pointer to value
+	* @param[in]	val_size	- Size of value data type in bytes
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_ser_put_val(uint8_t * const p_buf, const par_type_t * const p_val, const uint8_t val_size)
+	{
+		par_ser_raw_t raw = 0U;
+
+		switch ( val_size )
+		{
+			case 1U:
+				raw = p_val->u8;
+				break;
+
+			case 2U:
+				raw = p_val->u16;
+				break;
+
+			#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+				case 8U:
+					raw = p_val->u64;
+					break;
+			#endif
+
+			default:
+				raw = p_val->u32;
+				break;
+		}
+
+		for ( uint8_t i = 0U; i < val_size; i++ )
+		{
+			p_buf[i] = (uint8_t)( raw >> ( 8U * i ));
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get value from frame in little endianness format
+	*
+	* @param[in]	p_buf		- Pointer to value inside frame
+	* @param[out]	p_val		- Pointer to value
+	* @param[in]	val_size	- Size of value data type in bytes
+	* @return		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_ser_get_val(const uint8_t * const p_buf, par_type_t * const p_val, const uint8_t val_size)
+	{
+		par_ser_raw_t raw = 0U;
+
+		for ( uint8_t i = 0U; i < val_size; i++ )
+		{
+			raw |= ((par_ser_raw_t) p_buf[i] << ( 8U * i ));
+		}
+
+		switch ( val_size )
+		{
+			case 1U:
+				p_val->u8 = (uint8_t) raw;
+				break;
+
+			case 2U:
+				p_val->u16 = (uint16_t) raw;
+				break;
+
+			#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+				case 8U:
+					p_val->u64 = raw;
+					break;
+			#endif
+
+			default:
+				p_val->u32 = (uint32_t) raw;
+				break;
+		}
+	}
+
+#endif // 1 == PAR_CFG_SER_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_ser.h
+*@brief    	Parameter binary serialization
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_SER
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _PAR_SER_H_
+#define _PAR_SER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include "par.h"
+
+#if ( 1 == PAR_CFG_SER_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Definitions
+	////////////////////////////////////////////////////////////////////////////////
+
+	/**
+	 * 	Frame flags
+	 *
+	 * 	@note	Tells which optional fields follow value in each record.
+	 */
+	#define PAR_SER_FLAG_RANGE					( 0x01U )	/**<Min and max value */
+	#define PAR_SER_FLAG_DEF					( 0x02U )	/**<Default value */
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Functions Prototypes
+	////////////////////////////////////////////////////////////////////////////////
+	par_status_t par_ser_encode			(const par_num_t * const p_par_num, const uint32_t num, const uint8_t flags, uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len);
+	par_status_t par_ser_encode_range	(const par_num_t par_num_first, const uint32_t num, const uint8_t flags, uint8_t * const p_buf, const uint32_t size, uint32_t * const p_len);
+	par_status_t par_ser_decode			(const uint8_t * const p_buf, const uint32_t len, uint32_t * const p_num, uint32_t * const p_rej);
+
+#endif // 1 == PAR_CFG_SER_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // _PAR_SER_H_
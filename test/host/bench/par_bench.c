@@ -0,0 +1,1531 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_bench.c
+*@brief     Device parameters host microbenchmarks
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_BENCH
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host microbenchmarks of device parameters.
+*
+* @brief	Results are written to stdout as CSV, one row per benchmark.
+* 			NVM columns are number of NVM mock operations and bytes per
+* 			single benchmarked call.
+*
+* 			Failed operations and values not kept after store to NVM
+* 			and re-init are reported to stderr and give non-zero exit
+* 			code, so that "make bench" fails as regression test.
+*
+* 			Optional features enabled by build are checked as well, see
+* 			"make check" for builds that enable them.
+*
+* 			With "--nvm-in" NVM image written by other build is loaded
+* 			before init and its values are checked, with "--nvm-out" NVM
+* 			image is written at exit.
+*
+* 			Usage: par_bench [iterations] [--no-header] [--nvm-in file] [--nvm-out file]
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "par_cfg.h"
+#include "parameters/src/par.h"
+#include "parameters/src/par_nvm.h"
+#include "parameters/src/par_ser.h"
+#include "middleware/nvm/nvm/src/nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Default number of iterations of fast benchmarks
+ */
+#define PAR_BENCH_ITER_DEF						( 1000000UL )
+
+/**
+ * 	Divider of iterations for slow (init and NVM) benchmarks
+ */
+#define PAR_BENCH_ITER_SLOW_DIV					( 1000UL )
+
+/**
+ * 	Error part of parameter status
+ */
+#define PAR_BENCH_ERROR_MASK					( ePAR_ERROR | ePAR_ERROR_INIT | ePAR_ERROR_NVM | ePAR_ERROR_CRC )
+
+/**
+ * 	Read only parameter, last one in host tables
+ */
+#define PAR_BENCH_RO							(( par_num_t )( ePAR_NUM_OF - 1 ))
+
+/**
+ * 	Maximum number of "par_load_hndl()" calls until all parameters are loaded
+ */
+#define PAR_BENCH_LOAD_HNDL_MAX					( 10000UL )
+
+/**
+ * 	Fixed layout NVM image addresses, used to build images that can not
+ * 	be stored thru API: older object of other size (lazy loading) and
+ * 	image grown by objects of removed parameters (profiles)
+ *
+ * 	Unit: byte
+ */
+#if ( 1 == PAR_CFG_NVM_EN ) && ( 0 == PAR_CFG_NVM_PACKED_EN ) && ( 0 == PAR_CFG_NVM_AB_EN ) && ( 0 == PAR_CFG_NVM_JOURNAL_EN )
+	#define PAR_BENCH_NVM_STALE_EN				( PAR_CFG_NVM_LAZY_EN )
+	#define PAR_BENCH_NVM_GROW_EN				( PAR_CFG_PROFILE_EN )
+	#define PAR_BENCH_NVM_OBJ_NB_ADDR			( 4UL )
+	#define PAR_BENCH_NVM_HEAD_CRC_ADDR			( 6UL )
+	#define PAR_BENCH_NVM_FIRST_OBJ_ADDR		( 40UL )
+	#define PAR_BENCH_NVM_OBJ_HEAD_SIZE			( 4UL )
+	#define PAR_BENCH_NVM_OBJ_SIZE				( PAR_BENCH_NVM_OBJ_HEAD_SIZE + sizeof( par_type_t ))
+	#define PAR_BENCH_NVM_STALE_SIZE			( 2U )
+	#define PAR_BENCH_NVM_REMOVED_ID			( 0xFFF0U )
+#else
+	#define PAR_BENCH_NVM_STALE_EN				( 0 )
+	#define PAR_BENCH_NVM_GROW_EN				( 0 )
+#endif
+
+/**
+ * 	Time step of write-back deadline check and number of steps until deadline
+ */
+#if ( 1 == PAR_CFG_NVM_EN ) && ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+	#define PAR_BENCH_WB_STEP_MS				( PAR_CFG_NVM_WRITE_BACK_QUIET_MS / 2UL )
+	#define PAR_BENCH_WB_STEP_NUM				( PAR_CFG_NVM_WRITE_BACK_DEADLINE_MS / PAR_BENCH_WB_STEP_MS )
+#endif
+
+/**
+ * 	Typed parameter benchmark case
+ */
+typedef struct
+{
+	par_num_t		par_num;	/**<Benchmarked parameter */
+	const char *	p_type;		/**<Data type name */
+	par_type_t		val[2];		/**<Two in-range values set alternately */
+} par_bench_case_t;
+
+/**
+ * 	Benchmark measurement
+ */
+typedef struct
+{
+	uint64_t			start_ns;	/**<Start of measurement */
+	nvm_mock_stats_t	nvm;		/**<NVM counters at start */
+} par_bench_meas_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Typed benchmark cases
+ */
+static const par_bench_case_t g_par_bench_case[] =
+{
+	{ .par_num = ePAR_BENCH_U8, 	.p_type = "u8", 	.val = {{ .u8 = 20 }, 			{ .u8 = 30 }}},
+	{ .par_num = ePAR_BENCH_I8, 	.p_type = "i8", 	.val = {{ .i8 = -20 }, 			{ .i8 = 30 }}},
+	{ .par_num = ePAR_BENCH_U16, 	.p_type = "u16", 	.val = {{ .u16 = 2000 }, 		{ .u16 = 3000 }}},
+	{ .par_num = ePAR_BENCH_I16, 	.p_type = "i16", 	.val = {{ .i16 = -2000 }, 		{ .i16 = 3000 }}},
+	{ .par_num = ePAR_BENCH_U32, 	.p_type = "u32", 	.val = {{ .u32 = 200000 }, 		{ .u32 = 300000 }}},
+	{ .par_num = ePAR_BENCH_I32, 	.p_type = "i32", 	.val = {{ .i32 = -200000 }, 	{ .i32 = 300000 }}},
+	{ .par_num = ePAR_BENCH_F32, 	.p_type = "f32", 	.val = {{ .f32 = -2.5f }, 		{ .f32 = 3.5f }}},
+	{ .par_num = ePAR_BENCH_Q15, 	.p_type = "q15", 	.val = {{ .q15 = -2000 }, 		{ .q15 = 3000 }}},
+	{ .par_num = ePAR_BENCH_Q31, 	.p_type = "q31", 	.val = {{ .q31 = -200000 }, 	{ .q31 = 300000 }}},
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		{ .par_num = ePAR_BENCH_U64, 	.p_type = "u64", 	.val = {{ .u64 = 6000000000 }, 	{ .u64 = 7000000000 }}},
+		{ .par_num = ePAR_BENCH_I64, 	.p_type = "i64", 	.val = {{ .i64 = -6000000000 }, { .i64 = 7000000000 }}},
+	#endif
+};
+
+/**
+ * 	Number of typed benchmark cases
+ */
+#define PAR_BENCH_CASE_NUM						( sizeof( g_par_bench_case ) / sizeof( par_bench_case_t ))
+
+/**
+ * 	Sink of read values, prevents compiler to optimize reads away
+ */
+static volatile uint32_t gu32_par_bench_sink = 0UL;
+
+/**
+ * 	Number of failed operations
+ */
+static uint32_t gu32_par_bench_err = 0UL;
+
+#if ( 1 == PAR_CFG_NVM_LAZY_EN ) && ( 1 == PAR_CFG_NOTIFY_EN )
+
+	/**
+	 * 	Number of values read by subscriber during lazy loading
+	 */
+	static uint32_t gu32_par_bench_lazy_read = 0UL;
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t par_bench_get_ns		(void);
+static void 	par_bench_start			(par_bench_meas_t * const p_meas);
+static void 	par_bench_stop			(const par_bench_meas_t * const p_meas, const char * const p_bench, const char * const p_type, const uint32_t iter);
+static void 	par_bench_check			(const par_status_t status);
+static void 	par_bench_expect		(const bool cond, const char * const p_what);
+static bool 	par_bench_is_val		(const par_num_t par_num, const par_type_t * const p_val);
+static bool 	par_bench_is_cases		(const uint32_t idx);
+static void 	par_bench_set_cases		(const uint32_t idx);
+#if ( 1 == PAR_CFG_CHANGE_SEQ_EN ) || ( 1 == PAR_CFG_NOTIFY_EN )
+	static void par_bench_toggle		(const uint32_t c);
+#endif
+static void 	par_bench_set_get		(const uint32_t iter);
+static void 	par_bench_get_num_by_id	(const uint32_t iter);
+static void 	par_bench_round_trip	(void);
+static void 	par_bench_check_image	(void);
+static void 	par_bench_check_batch	(void);
+static void 	par_bench_check_ser		(void);
+static void 	par_bench_check_changes	(void);
+static void 	par_bench_check_notify	(void);
+static void 	par_bench_check_profile	(void);
+static void 	par_bench_check_journal	(void);
+static void 	par_bench_check_ab		(void);
+#if ( 1 == PAR_BENCH_NVM_STALE_EN ) || ( 1 == PAR_BENCH_NVM_GROW_EN )
+	static uint16_t par_bench_nvm_crc		(const uint8_t * const p_data, const uint32_t size);
+	static void 	par_bench_nvm_obj		(uint8_t * const p_obj, const uint16_t id, const void * const p_data, const uint8_t size);
+	static bool 	par_bench_nvm_head		(const uint16_t obj_nb);
+#endif
+#if ( 1 == PAR_BENCH_NVM_GROW_EN )
+	static void 	par_bench_nvm_grow		(const par_bench_case_t * const p_case);
+#endif
+#if ( 1 == PAR_BENCH_NVM_STALE_EN )
+	static void 	par_bench_nvm_stale		(const par_bench_case_t * const p_case);
+#endif
+static void 	par_bench_check_lazy	(void);
+static void 	par_bench_check_wb		(void);
+static void 	par_bench_init			(const uint32_t iter);
+static void 	par_bench_nvm			(const uint32_t iter);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get monotonic time
+*
+* @return 		time - Time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t par_bench_get_ns(void)
+{
+	struct timespec ts = { 0 };
+
+	(void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return (( (uint64_t) ts.tv_sec * 1000000000ULL ) + (uint64_t) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start measurement
+*
+* @param[out]	p_meas	- Measurement
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_start(par_bench_meas_t * const p_meas)
+{
+	nvm_mock_get_stats( &p_meas->nvm );
+	p_meas->start_ns = par_bench_get_ns();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stop measurement and print CSV row
+*
+* @param[in]	p_meas	- Measurement
+* @param[in]	p_bench	- Benchmark name
+* @param[in]	p_type	- Data type name
+* @param[in]	iter	- Number of benchmarked calls
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_stop(const par_bench_meas_t * const p_meas, const char * const p_bench, const char * const p_type, const uint32_t iter)
+{
+	const uint64_t 		stop_ns = par_bench_get_ns();
+	nvm_mock_stats_t	nvm		= { 0 };
+	const double		div		= (double) iter;
+
+	nvm_mock_get_stats( &nvm );
+
+	printf( "%s,%u,%s,%u,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n",
+			p_bench,
+			(unsigned) ePAR_NUM_OF,
+			p_type,
+			(unsigned) iter,
+			(double)( stop_ns - p_meas->start_ns ) / div,
+			(double)( nvm.read_cnt - p_meas->nvm.read_cnt ) / div,
+			(double)( nvm.read_bytes - p_meas->nvm.read_bytes ) / div,
+			(double)( nvm.write_cnt - p_meas->nvm.write_cnt ) / div,
+			(double)( nvm.write_bytes - p_meas->nvm.write_bytes ) / div,
+			(double)( nvm.erase_cnt - p_meas->nvm.erase_cnt ) / div,
+			(double)( nvm.sync_cnt - p_meas->nvm.sync_cnt ) / div );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Account failed operation
+*
+* @note		Warnings are not failures.
+*
+* @param[in]	status	- Status of operation
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check(const par_status_t status)
+{
+	if ( 0U != ( status & PAR_BENCH_ERROR_MASK ))
+	{
+		gu32_par_bench_err++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Account failed check
+*
+* @param[in]	cond	- Checked condition
+* @param[in]	p_what	- Description of check
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_expect(const bool cond, const char * const p_what)
+{
+	if ( true != cond )
+	{
+		fprintf( stderr, "par_bench: check failed: %s\n", p_what );
+		gu32_par_bench_err++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Compare parameter live value
+*
+* @note		Values are compared bitwise over size of data type.
+*
+* @param[in]	par_num	- Parameter number (enumeration)
+* @param[in]	p_val	- Expected value
+* @return 		is_val	- True if live value matches
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool par_bench_is_val(const par_num_t par_num, const par_type_t * const p_val)
+{
+	par_status_t	status	= ePAR_OK;
+	par_type_t		val		= { 0 };
+	par_type_list_t	type	= ePAR_TYPE_U8;
+	uint8_t			size	= 0U;
+
+	status |= par_get( par_num, &val );
+	status |= par_get_type( par_num, &type );
+	status |= par_get_type_size( type, &size );
+
+	par_bench_check( status );
+
+	return ( 0 == memcmp( &val, p_val, size ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check that all typed cases hold one of their values
+*
+* @param[in]	idx		- Index of value of typed case
+* @return 		is_val	- True if all live values match
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool par_bench_is_cases(const uint32_t idx)
+{
+	bool is_val = true;
+
+	for ( uint32_t c = 0; c < PAR_BENCH_CASE_NUM; c++ )
+	{
+		if ( true != par_bench_is_val( g_par_bench_case[c].par_num, &g_par_bench_case[c].val[idx] ))
+		{
+			fprintf( stderr, "par_bench: %s value %u expected\n", g_par_bench_case[c].p_type, (unsigned) idx );
+			is_val = false;
+		}
+	}
+
+	return is_val;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set all typed cases to one of their values
+*
+* @param[in]	idx	- Index of value of typed case
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_set_cases(const uint32_t idx)
+{
+	par_status_t status = ePAR_OK;
+
+	for ( uint32_t c = 0; c < PAR_BENCH_CASE_NUM; c++ )
+	{
+		status |= par_set( g_par_bench_case[c].par_num, &g_par_bench_case[c].val[idx] );
+	}
+
+	par_bench_check( status );
+}
+
+#if ( 1 == PAR_CFG_CHANGE_SEQ_EN ) || ( 1 == PAR_CFG_NOTIFY_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Change value of typed case to its other value
+	*
+	* @param[in]	c	- Typed case
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_bench_toggle(const uint32_t c)
+	{
+		const par_bench_case_t * const 	p_case 	= &g_par_bench_case[c];
+		const uint32_t					idx		= ( true == par_bench_is_val( p_case->par_num, &p_case->val[0] )) ? 1U : 0U;
+
+		par_bench_check( par_set( p_case->par_num, &p_case->val[idx] ));
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Benchmark "par_set()" and "par_get()" for each data type
+*
+* @param[in]	iter	- Number of iterations
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_set_get(const uint32_t iter)
+{
+	par_bench_meas_t 	meas 	= { 0 };
+	par_status_t		status	= ePAR_OK;
+	par_type_t			val		= { 0 };
+
+	for ( uint32_t c = 0; c < PAR_BENCH_CASE_NUM; c++ )
+	{
+		const par_bench_case_t * const p_case = &g_par_bench_case[c];
+
+		// Set, alternate value so that change is always applied
+		par_bench_start( &meas );
+
+		for ( uint32_t i = 0; i < iter; i++ )
+		{
+			status |= par_set( p_case->par_num, &p_case->val[ i & 1U ] );
+		}
+
+		par_bench_stop( &meas, "par_set", p_case->p_type, iter );
+
+		// Get
+		par_bench_start( &meas );
+
+		for ( uint32_t i = 0; i < iter; i++ )
+		{
+			status |= par_get( p_case->par_num, &val );
+			gu32_par_bench_sink += val.u32;
+		}
+
+		par_bench_stop( &meas, "par_get", p_case->p_type, iter );
+	}
+
+	par_bench_check( status );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Benchmark "par_get_num_by_id()" over all parameter IDs
+*
+* @param[in]	iter	- Number of iterations
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_get_num_by_id(const uint32_t iter)
+{
+	par_bench_meas_t 	meas 		= { 0 };
+	par_status_t		status		= ePAR_OK;
+	uint16_t			id[ ePAR_NUM_OF ];
+	par_num_t			par_num		= 0;
+
+	// Collect IDs first, so that lookup alone is measured
+	for ( uint32_t n = 0; n < ePAR_NUM_OF; n++ )
+	{
+		status |= par_get_id( (par_num_t) n, &id[n] );
+	}
+
+	par_bench_start( &meas );
+
+	for ( uint32_t i = 0, n = 0; i < iter; i++ )
+	{
+		status |= par_get_num_by_id( id[n], &par_num );
+		gu32_par_bench_sink += (uint32_t) par_num;
+
+		n++;
+		if ( n >= ePAR_NUM_OF )
+		{
+			n = 0;
+		}
+	}
+
+	par_bench_stop( &meas, "par_get_num_by_id", "all", iter );
+
+	par_bench_check( status );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check values read back after store to NVM and re-init
+*
+* @note		Each typed case is set to its first value, which differs from
+* 			default, so that value can only be read back from NVM. Values
+* 			are compared bitwise over size of data type.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_round_trip(void)
+{
+	#if ( 1 == PAR_CFG_NVM_EN )
+
+		par_status_t status = ePAR_OK;
+
+		par_bench_set_cases( 0U );
+
+		status |= par_save_all();
+		status |= par_deinit();
+		status |= par_init();
+
+		par_bench_expect( par_bench_is_cases( 0U ), "values kept after save and init" );
+
+		par_bench_check( status );
+
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check values of NVM image written by other build
+*
+* @note		Image is written by "--nvm-out" of build that stores first value
+* 			of each typed case, thus init on image of other layout shall
+* 			migrate it without loss.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_image(void)
+{
+	par_bench_expect( par_bench_is_cases( 0U ), "values kept from NVM image of other build" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check that "par_set_batch()" sets all values or none of them
+*
+* @note		Invalid batch is checked only without assertions, as it is
+* 			caught by assertion otherwise.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_batch(void)
+{
+	const par_bench_case_t * const 	p_u8 		= &g_par_bench_case[0];
+	const par_bench_case_t * const 	p_u16 		= &g_par_bench_case[2];
+	par_num_t						par_num[2]	= { p_u8->par_num, p_u16->par_num };
+	const void *					p_val[2]	= { &p_u8->val[1], &p_u16->val[1] };
+
+	par_bench_set_cases( 0U );
+
+	#if ( 0 == PAR_CFG_ASSERT_EN )
+		par_num[1] = ePAR_NUM_OF;
+
+		par_bench_expect( ePAR_OK != par_set_batch( par_num, p_val, 2U ), "batch with invalid parameter rejected" );
+		par_bench_expect( par_bench_is_val( p_u8->par_num, &p_u8->val[0] ), "batch with invalid parameter not applied" );
+
+		par_num[1] = p_u16->par_num;
+	#endif
+
+	par_bench_check( par_set_batch( par_num, p_val, 2U ));
+
+	par_bench_expect(	( par_bench_is_val( p_u8->par_num, &p_u8->val[1] ))
+					&&	( par_bench_is_val( p_u16->par_num, &p_u16->val[1] )), "batch applied" );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check serializer encode and decode
+*
+* @note		Typed cases are encoded, changed and restored from frame.
+* 			Record of read only parameter shall be skipped and truncated
+* 			frame shall not be applied at all.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_ser(void)
+{
+	#if ( 1 == PAR_CFG_SER_EN )
+
+		const par_bench_case_t * const 	p_u32		= &g_par_bench_case[4];
+		const par_num_t					par_num[2]	= { p_u32->par_num, PAR_BENCH_RO };
+		par_status_t					status		= ePAR_OK;
+		uint8_t							buf[256]	= { 0 };
+		uint32_t						len			= 0UL;
+		uint32_t						num			= 0UL;
+		uint32_t						rej			= 0UL;
+		par_type_t						ro_val		= { 0 };
+
+		_Static_assert( PAR_BENCH_CASE_NUM <= PAR_CFG_SER_DECODE_NUM, "All typed cases shall fit single decoded frame!" );
+
+		// Encode and restore
+		par_bench_set_cases( 0U );
+		status |= par_ser_encode_range( g_par_bench_case[0].par_num, PAR_BENCH_CASE_NUM, PAR_SER_FLAG_RANGE, buf, sizeof( buf ), &len );
+		par_bench_set_cases( 1U );
+		status |= par_ser_decode( buf, len, &num, &rej );
+
+		par_bench_expect(( PAR_BENCH_CASE_NUM == num ) && ( 0UL == rej ), "serializer frame applied" );
+		par_bench_expect( par_bench_is_cases( 0U ), "serializer values restored" );
+
+		// Truncated frame
+		par_bench_set_cases( 1U );
+
+		par_bench_expect( ePAR_OK != par_ser_decode( buf, ( len - 1UL ), &num, &rej ), "truncated serializer frame rejected" );
+		par_bench_expect(( 0UL == num ) && ( true == par_bench_is_cases( 1U )), "truncated serializer frame not applied" );
+
+		// Range wrapping around, rejected before encoding
+		#if ( 0 == PAR_CFG_ASSERT_EN )
+			buf[0] = 0U;
+
+			par_bench_expect(	( ePAR_OK != par_ser_encode_range( 1U, UINT32_MAX, PAR_SER_FLAG_RANGE, buf, sizeof( buf ), &len ))
+							&&	( 0U == buf[0] ), "wrapping serializer range rejected" );
+		#endif
+
+		// Read only parameter
+		status |= par_set( p_u32->par_num, &p_u32->val[0] );
+		status |= par_get( PAR_BENCH_RO, &ro_val );
+		status |= par_ser_encode( par_num, 2U, 0U, buf, sizeof( buf ), &len );
+
+		ro_val.u32++;
+		status |= par_set( PAR_BENCH_RO, &ro_val );
+		status |= par_set( p_u32->par_num, &p_u32->val[1] );
+		status |= par_ser_decode( buf, len, &num, &rej );
+
+		par_bench_expect(( 1UL == num ) && ( 1UL == rej ), "serializer read only record skipped" );
+		par_bench_expect( par_bench_is_val( PAR_BENCH_RO, &ro_val ), "serializer read only value kept" );
+		par_bench_expect( par_bench_is_val( p_u32->par_num, &p_u32->val[0] ), "serializer rest of frame applied" );
+
+		par_bench_check( status );
+
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check "par_get_changes_since()" delta query
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_changes(void)
+{
+	#if ( 1 == PAR_CFG_CHANGE_SEQ_EN )
+
+		par_status_t	status		= ePAR_OK;
+		uint32_t		seq			= 0UL;
+		uint32_t		num			= 0UL;
+		par_num_t		par_num[4]	= { 0 };
+
+		status |= par_get_change_seq( &seq );
+
+		// U8 changed twice, reported once at time of last change
+		par_bench_toggle( 0U );
+		par_bench_toggle( 2U );
+		par_bench_toggle( 0U );
+		par_bench_toggle( 4U );
+
+		// Oldest changes first, rest at next call
+		status |= par_get_changes_since( seq, par_num, 2UL, &num, &seq );
+
+		par_bench_expect(	( 2UL == num )
+						&&	( g_par_bench_case[2].par_num == par_num[0] )
+						&&	( g_par_bench_case[0].par_num == par_num[1] ), "oldest changes reported first" );
+
+		status |= par_get_changes_since( seq, par_num, 4UL, &num, &seq );
+
+		par_bench_expect(( 1UL == num ) && ( g_par_bench_case[4].par_num == par_num[0] ), "rest of changes reported at next call" );
+
+		status |= par_get_changes_since( seq, par_num, 4UL, &num, &seq );
+
+		par_bench_expect( 0UL == num, "no changes since last call" );
+
+		par_bench_check( status );
+
+	#endif
+}
+
+#if ( 1 == PAR_CFG_NOTIFY_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Count parameter change notification
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @param[in]	p_ctx	- Pointer to counter
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_bench_notify_cb(const par_num_t par_num, void * const p_ctx)
+	{
+		(void) par_num;
+
+		(*(uint32_t*) p_ctx)++;
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check parameter change notification
+*
+* @note		With "PAR_CFG_NOTIFY_DEFER_EN" subscribers shall be called only
+* 			from "par_notify_hndl()".
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_notify(void)
+{
+	#if ( 1 == PAR_CFG_NOTIFY_EN )
+
+		const par_bench_case_t * const 	p_u8	= &g_par_bench_case[0];
+		par_status_t					status	= ePAR_OK;
+		uint32_t						cnt_one	= 0UL;
+		uint32_t						cnt_all	= 0UL;
+		par_type_t						val		= { 0 };
+
+		// Changes made before subscription
+		status |= par_notify_hndl();
+
+		status |= par_subscribe( p_u8->par_num, par_bench_notify_cb, &cnt_one );
+		status |= par_subscribe( ePAR_NUM_OF, par_bench_notify_cb, &cnt_all );
+
+		par_bench_toggle( 0U );
+
+		#if ( 1 == PAR_CFG_NOTIFY_DEFER_EN )
+			par_bench_expect( 0UL == cnt_one, "deferred notification not called by setter" );
+			status |= par_notify_hndl();
+		#endif
+
+		par_bench_expect(( 1UL == cnt_one ) && ( 1UL == cnt_all ), "subscribers notified on change" );
+
+		// Same value is not a change
+		status |= par_get( p_u8->par_num, &val );
+		status |= par_set( p_u8->par_num, &val );
+		par_bench_toggle( 2U );
+		status |= par_notify_hndl();
+
+		par_bench_expect(( 1UL == cnt_one ) && ( 2UL == cnt_all ), "subscribers notified only on change" );
+
+		// Unsubscribed
+		status |= par_unsubscribe( p_u8->par_num, par_bench_notify_cb, &cnt_one );
+		status |= par_unsubscribe( ePAR_NUM_OF, par_bench_notify_cb, &cnt_all );
+
+		par_bench_toggle( 0U );
+		status |= par_notify_hndl();
+
+		par_bench_expect(( 1UL == cnt_one ) && ( 2UL == cnt_all ), "unsubscribed not notified" );
+
+		par_bench_check( status );
+
+	#endif
+}
+
+#if ( 1 == PAR_BENCH_NVM_STALE_EN ) || ( 1 == PAR_BENCH_NVM_GROW_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Calculate CRC-16 of NVM image
+	*
+	* @note		Same CRC-16-CCITT with custom seed as NVM module uses.
+	*
+	* @param[in]	p_data	- Pointer to data
+	* @param[in]	size	- Size of data
+	* @return 		crc16	- Calculated CRC
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static uint16_t par_bench_nvm_crc(const uint8_t * const p_data, const uint32_t size)
+	{
+		uint16_t crc16 = 0x1234U;
+
+		for ( uint32_t i = 0; i < size; i++ )
+		{
+			crc16 = (uint16_t)( crc16 ^ ( p_data[i] << 8U ));
+
+			for ( uint32_t j = 0; j < 8U; j++ )
+			{
+				if ( 0U != ( crc16 & 0x8000U ))
+				{
+					crc16 = (uint16_t)(( crc16 << 1U ) ^ 0x1021U );
+				}
+				else
+				{
+					crc16 = (uint16_t)( crc16 << 1U );
+				}
+			}
+		}
+
+		return crc16;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Build NVM data object
+	*
+	* @param[out]	p_obj	- Object, at least head and data size long
+	* @param[in]	id		- Parameter ID
+	* @param[in]	p_data	- Pointer to data
+	* @param[in]	size	- Size of data
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_bench_nvm_obj(uint8_t * const p_obj, const uint16_t id, const void * const p_data, const uint8_t size)
+	{
+		uint16_t crc = 0U;
+
+		memcpy( p_obj, &id, sizeof( id ));
+		p_obj[2] = size;
+		memcpy( &p_obj[ PAR_BENCH_NVM_OBJ_HEAD_SIZE ], p_data, size );
+
+		crc = par_bench_nvm_crc( p_obj, sizeof( id ));
+		crc ^= par_bench_nvm_crc( &p_obj[2], 1U );
+		crc ^= par_bench_nvm_crc( &p_obj[ PAR_BENCH_NVM_OBJ_HEAD_SIZE ], size );
+		p_obj[3] = (uint8_t)( crc & 0xFFU );
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Write number of objects into NVM image header
+	*
+	* @param[in]	obj_nb	- Number of stored objects
+	* @return 		is_ok	- True if written
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static bool par_bench_nvm_head(const uint16_t obj_nb)
+	{
+		const uint16_t	crc		= par_bench_nvm_crc((const uint8_t*) &obj_nb, sizeof( obj_nb ));
+		bool			is_ok	= true;
+
+		is_ok &= ( eNVM_OK == nvm_write( eNVM_REGION_EEPROM_RUN_PAR, PAR_BENCH_NVM_OBJ_NB_ADDR, sizeof( obj_nb ), (const uint8_t*) &obj_nb ));
+		is_ok &= ( eNVM_OK == nvm_write( eNVM_REGION_EEPROM_RUN_PAR, PAR_BENCH_NVM_HEAD_CRC_ADDR, sizeof( crc ), (const uint8_t*) &crc ));
+
+		return is_ok;
+	}
+
+#endif
+
+#if ( 1 == PAR_BENCH_NVM_GROW_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Grow NVM image up to profile slots
+	*
+	* @note		Object of typed case gets ID of removed parameter, thus it is
+	* 			added as new parameter at next init, and objects of removed
+	* 			parameter fill image up to first profile slot.
+	*
+	* @param[in]	p_case	- Typed case
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_bench_nvm_grow(const par_bench_case_t * const p_case)
+	{
+		uint8_t		obj[ PAR_BENCH_NVM_OBJ_SIZE ]	= { 0 };
+		uint32_t	obj_addr						= PAR_BENCH_NVM_FIRST_OBJ_ADDR;
+		uint16_t	obj_nb							= 0U;
+		uint16_t	id								= 0U;
+		bool		is_ok							= true;
+
+		is_ok &= ( eNVM_OK == nvm_read( eNVM_REGION_EEPROM_RUN_PAR, PAR_BENCH_NVM_OBJ_NB_ADDR, sizeof( obj_nb ), (uint8_t*) &obj_nb ));
+		is_ok &= ( ePAR_OK == par_get_id( p_case->par_num, &id ));
+
+		// Stored object of typed case becomes object of removed parameter
+		for ( uint16_t i = 0; ( i < obj_nb ) && ( true == is_ok ); i++, obj_addr += PAR_BENCH_NVM_OBJ_SIZE )
+		{
+			is_ok &= ( eNVM_OK == nvm_read( eNVM_REGION_EEPROM_RUN_PAR, obj_addr, PAR_BENCH_NVM_OBJ_SIZE, obj ));
+
+			if ( 0 == memcmp( obj, &id, sizeof( id )))
+			{
+				par_bench_nvm_obj( obj, PAR_BENCH_NVM_REMOVED_ID, &obj[ PAR_BENCH_NVM_OBJ_HEAD_SIZE ], sizeof( par_type_t ));
+				is_ok &= ( eNVM_OK == nvm_write( eNVM_REGION_EEPROM_RUN_PAR, obj_addr, PAR_BENCH_NVM_OBJ_SIZE, obj ));
+			}
+		}
+
+		// Fill image up to profile slots
+		par_bench_nvm_obj( obj, PAR_BENCH_NVM_REMOVED_ID, &p_case->val[1], sizeof( par_type_t ));
+
+		for ( ; (( obj_addr + PAR_BENCH_NVM_OBJ_SIZE ) <= PAR_CFG_NVM_PROFILE_ADDR ) && ( true == is_ok ); obj_addr += PAR_BENCH_NVM_OBJ_SIZE )
+		{
+			is_ok &= ( eNVM_OK == nvm_write( eNVM_REGION_EEPROM_RUN_PAR, obj_addr, PAR_BENCH_NVM_OBJ_SIZE, obj ));
+			obj_nb++;
+		}
+
+		is_ok &= par_bench_nvm_head( obj_nb );
+
+		par_bench_expect( is_ok, "NVM image grown up to profiles" );
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check parameter profiles capture, activation and store to NVM
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_profile(void)
+{
+	#if ( 1 == PAR_CFG_PROFILE_EN )
+
+		par_status_t	status	= ePAR_OK;
+		par_cfg_t		par_cfg	= { 0 };
+		bool			is_def	= true;
+
+		// Capture changed values only
+		status |= par_set_all_to_default();
+		par_bench_set_cases( 0U );
+		status |= par_profile_capture( 0U );
+		status |= par_profile_clear( 1U );
+
+		// Empty profile sets defaults
+		status |= par_profile_activate( 1U );
+
+		for ( uint32_t c = 0; c < PAR_BENCH_CASE_NUM; c++ )
+		{
+			status |= par_get_config( g_par_bench_case[c].par_num, &par_cfg );
+			is_def &= par_bench_is_val( g_par_bench_case[c].par_num, &par_cfg.def );
+		}
+
+		par_bench_expect( is_def, "empty profile sets defaults" );
+
+		status |= par_profile_activate( 0U );
+
+		par_bench_expect( par_bench_is_cases( 0U ), "profile values activated" );
+
+		// Stored profile loaded at init
+		#if ( 1 == PAR_CFG_NVM_EN )
+			status |= par_profile_save( 0U );
+			status |= par_deinit();
+			status |= par_init();
+			par_bench_set_cases( 1U );
+			status |= par_profile_activate( 0U );
+
+			par_bench_expect( par_bench_is_cases( 0U ), "profile kept after save and init" );
+		#endif
+
+		// Image grown by objects of removed parameters
+		#if ( 1 == PAR_BENCH_NVM_GROW_EN )
+		{
+			uint16_t obj_nb = 0U;
+
+			par_bench_nvm_grow( &g_par_bench_case[1] );
+			status |= par_deinit();
+
+			par_bench_expect( ePAR_WARN_NVM_REWRITTEN & par_init(), "grown image re-written at init" );
+			par_bench_set_cases( 1U );
+			status |= par_profile_activate( 0U );
+
+			par_bench_expect( par_bench_is_cases( 0U ), "profile kept after image grew" );
+
+			par_bench_expect(	( eNVM_OK == nvm_read( eNVM_REGION_EEPROM_RUN_PAR, PAR_BENCH_NVM_OBJ_NB_ADDR, sizeof( obj_nb ), (uint8_t*) &obj_nb ))
+							&&	( obj_nb <= ePAR_NUM_OF ), "NVM image re-written compactly" );
+		}
+		#endif
+
+		par_bench_check( status );
+
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check journal compaction
+*
+* @note		Single parameter is stored until journal sector is full, thus
+* 			compaction shall erase spare sector and keep values of all
+* 			parameters. Value that was only set is stored by compaction
+* 			too, thus it shall not be stored again by "par_save_dirty()".
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_journal(void)
+{
+	#if ( 1 == PAR_CFG_NVM_EN ) && ( 1 == PAR_CFG_NVM_JOURNAL_EN )
+
+		const par_bench_case_t * const 	p_i8	= &g_par_bench_case[1];
+		const par_bench_case_t * const 	p_u32	= &g_par_bench_case[4];
+		par_status_t					status	= ePAR_OK;
+		nvm_mock_stats_t				nvm		= { 0 };
+		nvm_mock_stats_t				nvm_now	= { 0 };
+		par_type_t						val		= { 0 };
+
+		par_bench_set_cases( 0U );
+		status |= par_save_all();
+
+		// Only set, not saved
+		status |= par_set( p_i8->par_num, &p_i8->val[1] );
+
+		nvm_mock_get_stats( &nvm );
+
+		// More records than fit into one sector
+		for ( uint32_t i = 0; i < ( PAR_CFG_NVM_JOURNAL_SECTOR_SIZE / 4UL ); i++ )
+		{
+			val.u32 = i;
+			status |= par_set( p_u32->par_num, &val );
+			status |= par_save( p_u32->par_num );
+		}
+
+		nvm_mock_get_stats( &nvm_now );
+
+		par_bench_expect( nvm.erase_cnt < nvm_now.erase_cnt, "journal compacted" );
+
+		status |= par_save_dirty();
+		nvm_mock_get_stats( &nvm );
+
+		par_bench_expect( nvm.write_cnt == nvm_now.write_cnt, "compacted values marked as stored" );
+
+		status |= par_deinit();
+		status |= par_init();
+
+		par_bench_expect( par_bench_is_val( p_u32->par_num, &val ), "last value kept after compaction" );
+		par_bench_expect( par_bench_is_val( p_i8->par_num, &p_i8->val[1] ), "value only set stored by compaction" );
+
+		status |= par_set( p_u32->par_num, &p_u32->val[0] );
+		status |= par_set( p_i8->par_num, &p_i8->val[0] );
+
+		par_bench_expect( par_bench_is_cases( 0U ), "values kept after compaction" );
+
+		par_bench_check( status );
+
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check A/B bank commit
+*
+* @note		Two commits are done, so that both banks are committed and
+* 			loaded once. Single parameter commit shall not store value
+* 			of other parameter that was only set.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_ab(void)
+{
+	#if ( 1 == PAR_CFG_NVM_EN ) && ( 1 == PAR_CFG_NVM_AB_EN )
+
+		par_status_t status = ePAR_OK;
+
+		for ( uint32_t idx = 0; idx < 2U; idx++ )
+		{
+			par_bench_set_cases( idx );
+
+			status |= par_save_all();
+			status |= par_deinit();
+			status |= par_init();
+
+			par_bench_expect( par_bench_is_cases( idx ), "values kept after bank commit" );
+		}
+
+		// Single parameter commit
+		status |= par_set( g_par_bench_case[0].par_num, &g_par_bench_case[0].val[0] );
+		status |= par_set( g_par_bench_case[1].par_num, &g_par_bench_case[1].val[0] );
+		status |= par_save( g_par_bench_case[0].par_num );
+		status |= par_deinit();
+		status |= par_init();
+
+		par_bench_expect( par_bench_is_val( g_par_bench_case[0].par_num, &g_par_bench_case[0].val[0] ), "value kept after single parameter commit" );
+		par_bench_expect( par_bench_is_val( g_par_bench_case[1].par_num, &g_par_bench_case[1].val[1] ), "value only set not committed" );
+
+		par_bench_check( status );
+
+	#endif
+}
+
+#if ( 1 == PAR_CFG_NVM_LAZY_EN ) && ( 1 == PAR_CFG_NOTIFY_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Read not yet loaded parameter from change notification
+	*
+	* @note		Notification of loaded value is called once NVM module
+	* 			returns, thus nested on demand load shall get stored value.
+	*
+	* @param[in]	par_num	- Parameter number (enumeration)
+	* @param[in]	p_ctx	- Unused
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_bench_lazy_cb(const par_num_t par_num, void * const p_ctx)
+	{
+		const par_bench_case_t * const p_last = &g_par_bench_case[ PAR_BENCH_CASE_NUM - 1U ];
+
+		(void) p_ctx;
+
+		if ( par_num != p_last->par_num )
+		{
+			par_bench_expect( par_bench_is_val( p_last->par_num, &p_last->val[0] ), "stored value read from notification" );
+			gu32_par_bench_lazy_read++;
+		}
+	}
+
+#endif
+
+#if ( 1 == PAR_BENCH_NVM_STALE_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Rewrite NVM image with older object of other size
+	*
+	* @note		Object of typed case is replaced by object of smaller size
+	* 			holding its second value and moved to end of image, as if
+	* 			data size of parameter changed and new object was added.
+	*
+	* @param[in]	p_case	- Typed case
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void par_bench_nvm_stale(const par_bench_case_t * const p_case)
+	{
+		uint8_t		obj[ ePAR_NUM_OF ][ PAR_BENCH_NVM_OBJ_SIZE ];
+		uint8_t		img[ ( ePAR_NUM_OF + 1U ) * PAR_BENCH_NVM_OBJ_SIZE ];
+		uint8_t *	p_img	= img;
+		uint8_t *	p_obj	= NULL;
+		uint16_t	obj_nb	= 0U;
+		uint16_t	id		= 0U;
+		bool		is_ok	= true;
+
+		is_ok &= ( eNVM_OK == nvm_read( eNVM_REGION_EEPROM_RUN_PAR, PAR_BENCH_NVM_OBJ_NB_ADDR, sizeof( obj_nb ), (uint8_t*) &obj_nb ));
+		is_ok &= ( obj_nb <= ePAR_NUM_OF );
+		is_ok &= ( ePAR_OK == par_get_id( p_case->par_num, &id ));
+
+		if ( true == is_ok )
+		{
+			is_ok &= ( eNVM_OK == nvm_read( eNVM_REGION_EEPROM_RUN_PAR, PAR_BENCH_NVM_FIRST_OBJ_ADDR, ( obj_nb * PAR_BENCH_NVM_OBJ_SIZE ), &obj[0][0] ));
+
+			for ( uint16_t i = 0; i < obj_nb; i++ )
+			{
+				// Older object of other size in place of stored one
+				if ( 0 == memcmp( obj[i], &id, sizeof( id )))
+				{
+					p_obj = obj[i];
+
+					par_bench_nvm_obj( p_img, id, &p_case->val[1], PAR_BENCH_NVM_STALE_SIZE );
+					p_img += ( PAR_BENCH_NVM_OBJ_HEAD_SIZE + PAR_BENCH_NVM_STALE_SIZE );
+				}
+				else
+				{
+					memcpy( p_img, obj[i], PAR_BENCH_NVM_OBJ_SIZE );
+					p_img += PAR_BENCH_NVM_OBJ_SIZE;
+				}
+			}
+
+			is_ok &= ( NULL != p_obj );
+		}
+
+		if ( true == is_ok )
+		{
+			// Newer object at end of image
+			memcpy( p_img, p_obj, PAR_BENCH_NVM_OBJ_SIZE );
+			p_img += PAR_BENCH_NVM_OBJ_SIZE;
+
+			is_ok &= ( eNVM_OK == nvm_write( eNVM_REGION_EEPROM_RUN_PAR, PAR_BENCH_NVM_FIRST_OBJ_ADDR, (uint32_t)( p_img - img ), img ));
+			is_ok &= par_bench_nvm_head( obj_nb + 1U );
+		}
+
+		par_bench_expect( is_ok, "NVM image with older object rewritten" );
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check lazy loading from NVM
+*
+* @note		Parameter written before it is loaded shall keep written value,
+* 			rest of parameters shall be loaded from NVM.
+*
+* 			With fixed layout image holding older object of other size
+* 			followed by newer one is loaded as well, newer one shall win.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_lazy(void)
+{
+	#if ( 1 == PAR_CFG_NVM_EN ) && ( 1 == PAR_CFG_NVM_LAZY_EN )
+
+		const par_bench_case_t * const 	p_u8		= &g_par_bench_case[0];
+		const par_bench_case_t * const 	p_u32		= &g_par_bench_case[4];
+		par_status_t					status		= ePAR_OK;
+		bool							is_loaded	= false;
+
+		par_bench_set_cases( 0U );
+
+		status |= par_save_all();
+		status |= par_deinit();
+		status |= par_init();
+
+		// Write before load
+		status |= par_is_loaded( p_u8->par_num, &is_loaded );
+		par_bench_expect( false == is_loaded, "parameter not loaded after init" );
+
+		status |= par_set( p_u8->par_num, &p_u8->val[1] );
+		is_loaded = false;
+
+		#if ( 1 == PAR_CFG_NOTIFY_EN )
+			gu32_par_bench_lazy_read = 0UL;
+			status |= par_subscribe( ePAR_NUM_OF, par_bench_lazy_cb, NULL );
+		#endif
+
+		// Background loading
+		for ( uint32_t i = 0; ( i < PAR_BENCH_LOAD_HNDL_MAX ) && ( false == is_loaded ); i++ )
+		{
+			status |= par_load_hndl();
+			status |= par_is_loaded( PAR_BENCH_RO, &is_loaded );
+		}
+
+		#if ( 1 == PAR_CFG_NOTIFY_EN )
+			status |= par_unsubscribe( ePAR_NUM_OF, par_bench_lazy_cb, NULL );
+			par_bench_expect( gu32_par_bench_lazy_read > 0UL, "loaded values notified" );
+		#endif
+
+		par_bench_expect( is_loaded, "all parameters loaded" );
+		par_bench_expect( par_bench_is_val( p_u8->par_num, &p_u8->val[1] ), "value written before load kept" );
+
+		status |= par_set( p_u8->par_num, &p_u8->val[0] );
+
+		par_bench_expect( par_bench_is_cases( 0U ), "values loaded from NVM" );
+
+		// Older object of other size followed by newer one
+		#if ( 1 == PAR_BENCH_NVM_STALE_EN )
+			par_bench_nvm_stale( p_u32 );
+
+			status |= par_deinit();
+			status |= par_init();
+
+			par_bench_expect( par_bench_is_val( p_u32->par_num, &p_u32->val[0] ), "newer object loaded on demand" );
+
+			status |= par_set( p_u32->par_num, &p_u32->val[1] );
+			status |= par_save( p_u32->par_num );
+			status |= par_deinit();
+			status |= par_init();
+
+			par_bench_expect( par_bench_is_val( p_u32->par_num, &p_u32->val[1] ), "value stored to newer object" );
+
+			status |= par_set( p_u32->par_num, &p_u32->val[0] );
+		#else
+			(void) p_u32;
+		#endif
+
+		par_bench_check( status );
+
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check deferred NVM write-back
+*
+* @note		Time is advanced by host interface instead of waiting. For
+* 			deadline new request is issued every half of quiet time.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_check_wb(void)
+{
+	#if ( 1 == PAR_CFG_NVM_EN ) && ( 1 == PAR_CFG_NVM_WRITE_BACK_EN )
+
+		const par_bench_case_t * const 	p_u32	= &g_par_bench_case[4];
+		par_status_t					status	= ePAR_OK;
+		nvm_mock_stats_t				nvm		= { 0 };
+		nvm_mock_stats_t				nvm_now	= { 0 };
+		uint32_t						store_ms = 0UL;
+
+		// Quiet time
+		nvm_mock_get_stats( &nvm );
+		status |= par_set_n_save( p_u32->par_num, &p_u32->val[0] );
+		status |= par_hndl();
+		nvm_mock_get_stats( &nvm_now );
+
+		par_bench_expect( nvm.write_cnt == nvm_now.write_cnt, "write-back not stored before quiet time" );
+
+		par_if_host_add_time_ms( PAR_CFG_NVM_WRITE_BACK_QUIET_MS );
+		status |= par_hndl();
+		nvm_mock_get_stats( &nvm_now );
+
+		par_bench_expect( nvm.write_cnt < nvm_now.write_cnt, "write-back stored after quiet time" );
+
+		// Deadline, new request before each quiet time elapses
+		nvm_mock_get_stats( &nvm );
+
+		for ( uint32_t i = 0; ( i <= PAR_BENCH_WB_STEP_NUM ) && ( nvm.write_cnt == nvm_now.write_cnt ); i++ )
+		{
+			status |= par_set_n_save( p_u32->par_num, &p_u32->val[ ( i + 1U ) & 1U ] );
+			status |= par_hndl();
+			nvm_mock_get_stats( &nvm_now );
+
+			store_ms = ( i * PAR_BENCH_WB_STEP_MS );
+			par_if_host_add_time_ms( PAR_BENCH_WB_STEP_MS );
+		}
+
+		par_bench_expect( nvm.write_cnt < nvm_now.write_cnt, "write-back stored at deadline" );
+		par_bench_expect( store_ms >= PAR_CFG_NVM_WRITE_BACK_DEADLINE_MS, "write-back not stored before deadline" );
+
+		// Flush
+		nvm_mock_get_stats( &nvm );
+		status |= par_set_n_save( p_u32->par_num, &p_u32->val[0] );
+		status |= par_flush();
+		nvm_mock_get_stats( &nvm_now );
+
+		par_bench_expect( nvm.write_cnt < nvm_now.write_cnt, "write-back stored by flush" );
+
+		status |= par_deinit();
+		status |= par_init();
+
+		par_bench_expect( par_bench_is_val( p_u32->par_num, &p_u32->val[0] ), "flushed value kept after init" );
+
+		par_bench_check( status );
+
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Benchmark "par_init()" boot time
+*
+* @note		NVM image holds non-default values of all parameters, so that
+* 			complete load path is measured. De-init is not timed.
+*
+* @param[in]	iter	- Number of iterations
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_init(const uint32_t iter)
+{
+	par_bench_meas_t 	meas 	= { 0 };
+	par_status_t		status	= ePAR_OK;
+	uint64_t			sum_ns	= 0ULL;
+	nvm_mock_stats_t	nvm		= { 0 };
+
+	// Time only init, subtract de-init from total
+	par_bench_start( &meas );
+	nvm = meas.nvm;
+
+	for ( uint32_t i = 0; i < iter; i++ )
+	{
+		status |= par_deinit();
+
+		const uint64_t start_ns = par_bench_get_ns();
+		status |= par_init();
+		sum_ns += par_bench_get_ns() - start_ns;
+	}
+
+	meas.start_ns = par_bench_get_ns() - sum_ns;
+	meas.nvm = nvm;
+
+	par_bench_stop( &meas, "par_init", "all", iter );
+
+	par_bench_check( status );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Benchmark loading and writing of all parameters from/to NVM
+*
+* @note		"par_nvm_load_all()" is internal to NVM module and is called
+* 			from "par_nvm_init()", therefore load is measured as
+* 			"par_nvm_init()" after "par_nvm_deinit()". Result includes
+* 			header validation.
+*
+* @param[in]	iter	- Number of iterations
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_bench_nvm(const uint32_t iter)
+{
+	#if ( 1 == PAR_CFG_NVM_EN )
+
+		par_bench_meas_t 	meas 	= { 0 };
+		par_status_t		status	= ePAR_OK;
+		uint64_t			sum_ns	= 0ULL;
+
+		// Load
+		par_bench_start( &meas );
+
+		for ( uint32_t i = 0; i < iter; i++ )
+		{
+			status |= par_nvm_deinit();
+
+			const uint64_t start_ns = par_bench_get_ns();
+			status |= par_nvm_init();
+			sum_ns += par_bench_get_ns() - start_ns;
+		}
+
+		meas.start_ns = par_bench_get_ns() - sum_ns;
+
+		par_bench_stop( &meas, "par_nvm_load_all", "all", iter );
+
+		// Write
+		par_bench_start( &meas );
+
+		for ( uint32_t i = 0; i < iter; i++ )
+		{
+			status |= par_nvm_write_all();
+		}
+
+		par_bench_stop( &meas, "par_nvm_write_all", "all", iter );
+
+		par_bench_check( status );
+
+	#else
+		(void) iter;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Run all benchmarks
+*
+* @param[in]	argc	- Number of arguments
+* @param[in]	argv	- Arguments
+* @return 		exit code, non-zero on failed operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	uint32_t 		iter 		= PAR_BENCH_ITER_DEF;
+	uint32_t		iter_slow	= 0UL;
+	bool			header		= true;
+	par_status_t	status		= ePAR_OK;
+	const char *	p_nvm_in	= NULL;
+	const char *	p_nvm_out	= NULL;
+
+	for ( int a = 1; a < argc; a++ )
+	{
+		if ( 0 == strcmp( argv[a], "--no-header" ))
+		{
+			header = false;
+		}
+		else if (( 0 == strcmp( argv[a], "--nvm-in" )) && (( a + 1 ) < argc ))
+		{
+			p_nvm_in = argv[ ++a ];
+		}
+		else if (( 0 == strcmp( argv[a], "--nvm-out" )) && (( a + 1 ) < argc ))
+		{
+			p_nvm_out = argv[ ++a ];
+		}
+		else
+		{
+			iter = (uint32_t) strtoul( argv[a], NULL, 10 );
+		}
+	}
+
+	if ( 0UL == iter )
+	{
+		iter = PAR_BENCH_ITER_DEF;
+	}
+
+	iter_slow = iter / PAR_BENCH_ITER_SLOW_DIV;
+
+	if ( 0UL == iter_slow )
+	{
+		iter_slow = 1UL;
+	}
+
+	if ( true == header )
+	{
+		printf( "bench,table_size,type,iterations,ns_per_op,nvm_read_ops,nvm_read_bytes,nvm_write_ops,nvm_write_bytes,nvm_erase_ops,nvm_sync_ops\n" );
+	}
+
+	// First boot on erased NVM or on image of other build
+	if ( NULL != p_nvm_in )
+	{
+		par_bench_expect( eNVM_OK == nvm_mock_load_image( p_nvm_in ), "NVM image loaded" );
+	}
+
+	status |= par_init();
+	par_bench_check( status );
+
+	if ( NULL != p_nvm_in )
+	{
+		par_bench_check_image();
+	}
+
+	par_bench_set_get( iter );
+	par_bench_get_num_by_id( iter );
+
+	// Feature checks, skipped if feature is not enabled by build
+	par_bench_check_batch();
+	par_bench_check_ser();
+	par_bench_check_changes();
+	par_bench_check_notify();
+	par_bench_check_profile();
+	par_bench_check_journal();
+	par_bench_check_ab();
+	par_bench_check_lazy();
+	par_bench_check_wb();
+
+	// Store non-default values for load benchmarks
+	par_bench_round_trip();
+
+	par_bench_init( iter_slow );
+	par_bench_nvm( iter_slow );
+
+	if ( NULL != p_nvm_out )
+	{
+		par_bench_expect( eNVM_OK == nvm_mock_store_image( p_nvm_out ), "NVM image stored" );
+	}
+
+	if ( 0UL != gu32_par_bench_err )
+	{
+		fprintf( stderr, "par_bench: %u failed operations\n", (unsigned) gu32_par_bench_err );
+	}
+
+	return ( 0UL == gu32_par_bench_err ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_cfg.c
+*@brief     Configuration for device parameters host build
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host build parameter table.
+*
+* @note		One parameter of each data type followed by persistent U32
+* 			filler parameters up to "PAR_HOST_TABLE_SIZE". Filler part is
+* 			built at first table request, so that table size is set only
+* 			by build option. Last filler is read only.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "par_cfg.h"
+#include "parameters/src/par.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *	Parameters definitions
+ */
+static par_cfg_t g_par_table[ePAR_NUM_OF] =
+{
+	// --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//							ID			Name			Min 					Max 					Def 					Unit		Data type				PC Access					Persistent			Description
+	// --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+	[ePAR_BENCH_U8] 	= 	{	.id = 1, 	.name = "U8",	.min.u8 = 0,			.max.u8 = 200,			.def.u8 = 10,			.unit = NULL,	.type = ePAR_TYPE_U8,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "U8 parameter"	},
+	[ePAR_BENCH_I8] 	= 	{	.id = 2, 	.name = "I8",	.min.i8 = -100,			.max.i8 = 100,			.def.i8 = -10,			.unit = NULL,	.type = ePAR_TYPE_I8,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "I8 parameter"	},
+	[ePAR_BENCH_U16] 	= 	{	.id = 3, 	.name = "U16",	.min.u16 = 0,			.max.u16 = 60000,		.def.u16 = 1000,		.unit = NULL,	.type = ePAR_TYPE_U16,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "U16 parameter"	},
+	[ePAR_BENCH_I16] 	= 	{	.id = 4, 	.name = "I16",	.min.i16 = -30000,		.max.i16 = 30000,		.def.i16 = -1000,		.unit = NULL,	.type = ePAR_TYPE_I16,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "I16 parameter"	},
+	[ePAR_BENCH_U32] 	= 	{	.id = 5, 	.name = "U32",	.min.u32 = 0,			.max.u32 = 4000000000,	.def.u32 = 100000,		.unit = NULL,	.type = ePAR_TYPE_U32,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "U32 parameter"	},
+	[ePAR_BENCH_I32] 	= 	{	.id = 6, 	.name = "I32",	.min.i32 = -2000000000,	.max.i32 = 2000000000,	.def.i32 = -100000,		.unit = NULL,	.type = ePAR_TYPE_I32,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "I32 parameter"	},
+	[ePAR_BENCH_F32] 	= 	{	.id = 7, 	.name = "F32",	.min.f32 = -1000.0f,	.max.f32 = 1000.0f,		.def.f32 = 0.5f,		.unit = "V",	.type = ePAR_TYPE_F32,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "F32 parameter"	},
+	[ePAR_BENCH_Q15] 	= 	{	.id = 8, 	.name = "Q15",	.min.q15 = -16384,		.max.q15 = 16384,		.def.q15 = 0,			.unit = NULL,	.type = ePAR_TYPE_Q15,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "Q15 parameter"	},
+	[ePAR_BENCH_Q31] 	= 	{	.id = 9, 	.name = "Q31",	.min.q31 = -1073741824,	.max.q31 = 1073741824,	.def.q31 = 0,			.unit = NULL,	.type = ePAR_TYPE_Q31,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "Q31 parameter"	},
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+	[ePAR_BENCH_U64] 	= 	{	.id = 10, 	.name = "U64",	.min.u64 = 0,			.max.u64 = 10000000000,	.def.u64 = 5000000000,	.unit = NULL,	.type = ePAR_TYPE_U64,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "U64 parameter"	},
+	[ePAR_BENCH_I64] 	= 	{	.id = 11, 	.name = "I64",	.min.i64 = -10000000000,	.max.i64 = 10000000000,	.def.i64 = -5000000000,	.unit = NULL,	.type = ePAR_TYPE_I64,	.access = ePAR_ACCESS_RW, 	.persistant = true,	.desc = "I64 parameter"	},
+	#endif
+
+	// --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+};
+
+/**
+ * 	Filler parameters built flag
+ */
+static bool gb_par_table_is_built = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Fill rest of parameter table
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void par_cfg_build_table(void)
+{
+	for ( uint32_t par_num = ePAR_BENCH_FILL; par_num < ePAR_NUM_OF; par_num++ )
+	{
+		g_par_table[par_num].id 		= (uint16_t)( PAR_HOST_FILL_ID_START + par_num );
+		g_par_table[par_num].name 		= "Fill";
+		g_par_table[par_num].min.u32 	= 0UL;
+		g_par_table[par_num].max.u32 	= 1000000UL;
+		g_par_table[par_num].def.u32 	= par_num;
+		g_par_table[par_num].unit 		= NULL;
+		g_par_table[par_num].type 		= ePAR_TYPE_U32;
+		g_par_table[par_num].access 	= ((( ePAR_NUM_OF - 1 ) == par_num ) ? ePAR_ACCESS_RO : ePAR_ACCESS_RW );
+		g_par_table[par_num].persistant = true;
+		g_par_table[par_num].desc 		= "Filler parameter";
+	}
+
+	gb_par_table_is_built = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get parameter configuration table
+*
+* @return		pointer to configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+const void * par_cfg_get_table(void)
+{
+	if ( false == gb_par_table_is_built )
+	{
+		par_cfg_build_table();
+	}
+
+	return (const par_cfg_t*) &g_par_table;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get configuration table size in bytes
+*
+* @return	size	- Size of table in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t par_cfg_get_table_size(void)
+{
+	return sizeof( g_par_table );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_cfg.h
+*@brief    	Configuration for device parameters host build
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host build configuration.
+*
+* @note		Options are common to all host configurations and are kept
+* 			in par_cfg_host.h, each of them can be overridden from command
+* 			line, e.g. "-DPAR_CFG_NVM_PACKED_EN=1".
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _PAR_CFG_H_
+#define _PAR_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#include "par_cfg_host.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of parameters in table
+ *
+ * 	@note	First parameters are one of each data type, rest of table
+ * 			is filled with persistent U32 parameters, last of them read
+ * 			only. U64 and I64 only with "PAR_CFG_TYPE_64BIT_EN".
+ */
+#ifndef PAR_HOST_TABLE_SIZE
+	#define PAR_HOST_TABLE_SIZE						( 64 )
+#endif
+
+/**
+ * 	List of device parameters
+ */
+typedef enum
+{
+	ePAR_BENCH_U8 = 0,
+	ePAR_BENCH_I8,
+	ePAR_BENCH_U16,
+	ePAR_BENCH_I16,
+	ePAR_BENCH_U32,
+	ePAR_BENCH_I32,
+	ePAR_BENCH_F32,
+	ePAR_BENCH_Q15,
+	ePAR_BENCH_Q31,
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		ePAR_BENCH_U64,
+		ePAR_BENCH_I64,
+	#endif
+
+	ePAR_BENCH_FILL,
+
+	ePAR_NUM_OF = PAR_HOST_TABLE_SIZE
+} par_num_t;
+
+_Static_assert( PAR_HOST_TABLE_SIZE > ePAR_BENCH_FILL, "PAR_HOST_TABLE_SIZE too small!" );
+
+/**
+ * 	Parameter ID of first filler parameter
+ */
+#define PAR_HOST_FILL_ID_START					( 100U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+const void * 	par_cfg_get_table		(void);
+uint32_t	 	par_cfg_get_table_size	(void);
+
+#endif // _PAR_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,273 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_cfg_host.h
+*@brief    	Common options of device parameters host build configurations
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Options shared by cfg/par_cfg.h and cfg_static/par_cfg.h.
+*
+* @note		Same options as in template/par_cfg.htmp, each of them can be
+* 			overridden from command line, e.g. "-DPAR_CFG_NVM_PACKED_EN=1".
+* 			Including configuration defines "PAR_HOST_TABLE_SIZE" and
+* 			"PAR_HOST_FILL_ID_START".
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _PAR_CFG_HOST_H_
+#define _PAR_CFG_HOST_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Multiple access protection, no-op mutex on host
+ */
+#ifndef PAR_CFG_MUTEX_EN
+	#define PAR_CFG_MUTEX_EN						( 1 )
+#endif
+
+#if ( 1 == PAR_CFG_MUTEX_EN )
+	#ifndef PAR_CFG_MUTEX_RW_EN
+		#define PAR_CFG_MUTEX_RW_EN					( 0 )
+	#endif
+#endif
+
+/**
+ * 	Layout options
+ *
+ * 	@note	Static layout, split table and shared memory are enabled by
+ * 			cfg_static/par_cfg.h, as they need "PAR_CFG_TABLE" list.
+ */
+#ifndef PAR_CFG_STATIC_LAYOUT_EN
+	#define PAR_CFG_STATIC_LAYOUT_EN				( 0 )
+#endif
+
+#ifndef PAR_CFG_TABLE_SOA_EN
+	#define PAR_CFG_TABLE_SOA_EN					( 0 )
+#endif
+
+#ifndef PAR_CFG_COMPACT_EN
+	#define PAR_CFG_COMPACT_EN						( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_COMPACT_EN )
+	#ifndef PAR_CFG_COMPACT_OFFSET_SIZE
+		#define PAR_CFG_COMPACT_OFFSET_SIZE			( 2 )
+	#endif
+#endif
+
+#ifndef PAR_CFG_SHARED_EN
+	#define PAR_CFG_SHARED_EN						( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_SHARED_EN )
+	#ifndef PAR_CFG_SHARED_OWNER_EN
+		#define PAR_CFG_SHARED_OWNER_EN				( 1 )
+	#endif
+
+	#define PAR_CFG_SHARED_SYMBOL					( par_shared )
+#endif
+
+#ifndef PAR_CFG_TYPE_64BIT_EN
+	#define PAR_CFG_TYPE_64BIT_EN					( 0 )
+#endif
+
+#ifndef PAR_CFG_ARRAY_EN
+	#define PAR_CFG_ARRAY_EN						( 0 )
+#endif
+
+/**
+ * 	ID look-up table
+ */
+#ifndef PAR_CFG_ID_LUT_DIRECT_EN
+	#define PAR_CFG_ID_LUT_DIRECT_EN				( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_ID_LUT_DIRECT_EN )
+	#define PAR_CFG_ID_LUT_MAX_ID					( PAR_HOST_FILL_ID_START + PAR_HOST_TABLE_SIZE )
+#endif
+
+/**
+ * 	Optional features
+ */
+#ifndef PAR_CFG_SNAPSHOT_EN
+	#define PAR_CFG_SNAPSHOT_EN						( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_SNAPSHOT_EN )
+	#define PAR_CFG_SNAPSHOT_RETRY_NUM				( 4 )
+#endif
+
+#ifndef PAR_CFG_CHANGE_SEQ_EN
+	#define PAR_CFG_CHANGE_SEQ_EN					( 0 )
+#endif
+
+#ifndef PAR_CFG_NOTIFY_EN
+	#define PAR_CFG_NOTIFY_EN						( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_NOTIFY_EN )
+	#ifndef PAR_CFG_NOTIFY_SUB_NUM
+		#define PAR_CFG_NOTIFY_SUB_NUM				( 8 )
+	#endif
+
+	#ifndef PAR_CFG_NOTIFY_DEFER_EN
+		#define PAR_CFG_NOTIFY_DEFER_EN				( 0 )
+	#endif
+#endif
+
+#ifndef PAR_CFG_PROFILE_EN
+	#define PAR_CFG_PROFILE_EN						( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_PROFILE_EN )
+	#define PAR_CFG_PROFILE_NUM						( 4 )
+	#define PAR_CFG_PROFILE_ENTRY_NUM				( 16 )
+#endif
+
+#ifndef PAR_CFG_SER_EN
+	#define PAR_CFG_SER_EN							( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_SER_EN )
+	#define PAR_CFG_SER_DECODE_NUM					( 16 )
+#endif
+
+#ifndef PAR_CFG_STATS_EN
+	#define PAR_CFG_STATS_EN						( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_STATS_EN )
+	#ifndef PAR_CFG_STATS_TIMING_EN
+		#define PAR_CFG_STATS_TIMING_EN				( 0 )
+	#endif
+#endif
+
+/**
+ * 	NVM storage, RAM backed mock on host
+ */
+#ifndef PAR_CFG_NVM_EN
+	#define PAR_CFG_NVM_EN							( 1 )
+#endif
+
+#if ( 1 == PAR_CFG_NVM_EN )
+	#define PAR_CFG_NVM_REGION						( eNVM_REGION_EEPROM_RUN_PAR )
+
+	#ifndef PAR_CFG_NVM_LOAD_BUF_SIZE
+		#define PAR_CFG_NVM_LOAD_BUF_SIZE			( 256 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_CRC_TABLE_SIZE
+		#define PAR_CFG_NVM_CRC_TABLE_SIZE			( 16 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_CRC_HW_EN
+		#define PAR_CFG_NVM_CRC_HW_EN				( 0 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_PACKED_EN
+		#define PAR_CFG_NVM_PACKED_EN				( 0 )
+	#endif
+
+	#ifndef PAR_CFG_TABLE_ID_CHECK_EN
+		#define PAR_CFG_TABLE_ID_CHECK_EN			( 0 )
+	#endif
+
+	#ifndef PAR_CFG_TABLE_ID_COMPACT_EN
+		#define PAR_CFG_TABLE_ID_COMPACT_EN			( 0 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_WRITE_BACK_EN
+		#define PAR_CFG_NVM_WRITE_BACK_EN			( 0 )
+	#endif
+
+	#define PAR_CFG_NVM_WRITE_BACK_QUIET_MS			( 500 )
+	#define PAR_CFG_NVM_WRITE_BACK_DEADLINE_MS		( 5000 )
+
+	#ifndef PAR_CFG_NVM_POLICY_EN
+		#define PAR_CFG_NVM_POLICY_EN				( 0 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_JOURNAL_EN
+		#define PAR_CFG_NVM_JOURNAL_EN				( 0 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_JOURNAL_SECTOR_SIZE
+		#define PAR_CFG_NVM_JOURNAL_SECTOR_SIZE		( 16384 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_AB_EN
+		#define PAR_CFG_NVM_AB_EN					( 0 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_AB_BANK_SIZE
+		#define PAR_CFG_NVM_AB_BANK_SIZE			( 16384 )
+	#endif
+
+	#ifndef PAR_CFG_NVM_LAZY_EN
+		#define PAR_CFG_NVM_LAZY_EN					( 0 )
+	#endif
+
+	#define PAR_CFG_NVM_PROFILE_ADDR				( 32768 )
+#endif
+
+/**
+ * 	Debug and assertions
+ *
+ * 	@note	Disabled by default, so that benchmarks measure release build.
+ */
+#ifndef PAR_CFG_DEBUG_EN
+	#define PAR_CFG_DEBUG_EN						( 0 )
+#endif
+
+#ifndef PAR_CFG_ASSERT_EN
+	#define PAR_CFG_ASSERT_EN						( 0 )
+#endif
+
+#if ( 1 == PAR_CFG_DEBUG_EN )
+	#define PAR_DBG_PRINT( ... )				( printf( __VA_ARGS__ ), printf( "\n" ))
+#else
+	#define PAR_DBG_PRINT( ... )				{ ; }
+#endif
+
+#if ( 1 == PAR_CFG_ASSERT_EN )
+	#define PAR_ASSERT(x)						assert(x)
+#else
+	#define PAR_ASSERT(x)						{ ; }
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Host build only, see cfg/par_if.c
+ */
+void par_if_host_add_time_ms(const uint32_t ms);
+
+#endif // _PAR_CFG_HOST_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,349 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_if.c
+*@brief     Interface with device parameters for host build
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_IF
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host interface layer for device parameters.
+*
+* @note		Single threaded host build, therefore hardware semaphore is
+* 			no-op and mutexes are only flags. Acquire of mutex that is
+* 			already held fails, the same as timeout of non-recursive OS
+* 			mutex on target, so that nested locking is caught on host.
+* 			Time is taken from POSIX monotonic clock.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+
+#include "par_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of hash
+ *
+ * 	Unit: byte
+ */
+#define PAR_IF_HASH_SIZE						( 32U )
+
+/**
+ * 	CRC-16 CCITT polynomial
+ */
+#define PAR_IF_CRC_POLY							( 0x1021U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	System time offset, advanced by checks instead of waiting
+ *
+ * 	Unit: ms
+ */
+static uint32_t gu32_par_if_time_offset_ms = 0UL;
+
+/**
+ * 	Mutexes held flags and number of readers
+ */
+static bool 	gb_par_if_mutex 		= false;
+static uint32_t	gu32_par_if_mutex_rd	= 0UL;
+static bool 	gb_par_if_nvm_mutex 	= false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t par_if_get_ns(void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get monotonic time
+*
+* @return 		time - Time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t par_if_get_ns(void)
+{
+	struct timespec ts = { 0 };
+
+	(void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return (( (uint64_t) ts.tv_sec * 1000000000ULL ) + (uint64_t) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize low level interface
+*
+* @return 		status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_init(void)
+{
+	return ePAR_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Acquire mutex
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_aquire_mutex(void)
+{
+	par_status_t status = ePAR_ERROR;
+
+	if ( ( false == gb_par_if_mutex ) && ( 0UL == gu32_par_if_mutex_rd ) )
+	{
+		gb_par_if_mutex = true;
+		status = ePAR_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release mutex
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_release_mutex(void)
+{
+	gb_par_if_mutex = false;
+
+	return ePAR_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Acquire mutex for reading
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_aquire_mutex_rd(void)
+{
+	par_status_t status = ePAR_ERROR;
+
+	if ( false == gb_par_if_mutex )
+	{
+		gu32_par_if_mutex_rd++;
+		status = ePAR_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release mutex for reading
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_release_mutex_rd(void)
+{
+	if ( gu32_par_if_mutex_rd > 0UL )
+	{
+		gu32_par_if_mutex_rd--;
+	}
+
+	return ePAR_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Acquire lazy NVM load mutex
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_aquire_nvm_mutex(void)
+{
+	par_status_t status = ePAR_ERROR;
+
+	if ( false == gb_par_if_nvm_mutex )
+	{
+		gb_par_if_nvm_mutex = true;
+		status = ePAR_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release lazy NVM load mutex
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_release_nvm_mutex(void)
+{
+	gb_par_if_nvm_mutex = false;
+
+	return ePAR_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Acquire hardware semaphore
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_aquire_hsem(void)
+{
+	return ePAR_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release hardware semaphore
+*
+* @return 		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+par_status_t par_if_release_hsem(void)
+{
+	return ePAR_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate hash
+*
+* @note		Not cryptographic, FNV-1a spread over hash size. Good enough
+* 			to detect table change on host.
+*
+* @param[in]	p_data	- Pointer to data
+* @param[in]	size	- Size of data in bytes
+* @param[out]	p_hash	- Pointer to 32 byte hash
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void par_if_calc_hash(const uint8_t * const p_data, const uint32_t size, uint8_t * const p_hash)
+{
+	uint32_t hash = 2166136261UL;
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		hash ^= p_data[i];
+		hash *= 16777619UL;
+	}
+
+	for ( uint32_t i = 0; i < PAR_IF_HASH_SIZE; i++ )
+	{
+		hash ^= i;
+		hash *= 16777619UL;
+		p_hash[i] = (uint8_t)( hash >> 24U );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get system time
+*
+* @return 		time - Time in ms
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t par_if_get_time_ms(void)
+{
+	return (uint32_t)( par_if_get_ns() / 1000000ULL ) + gu32_par_if_time_offset_ms;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Advance system time
+*
+* @note		Host build only, so that time based behaviour can be checked
+* 			without waiting.
+*
+* @param[in]	ms	- Time step in ms
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void par_if_host_add_time_ms(const uint32_t ms)
+{
+	gu32_par_if_time_offset_ms += ms;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate CRC-16
+*
+* @note		CRC-16 CCITT, polynomial 0x1021, no reflection, no final XOR,
+* 			same as on target.
+*
+* @param[in]	p_data	- Pointer to data
+* @param[in]	size	- Size of data in bytes
+* @param[in]	seed	- Initial CRC value
+* @return 		crc16	- Calculated CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint16_t par_if_calc_crc(const uint8_t * const p_data, const uint32_t size, const uint16_t seed)
+{
+	uint16_t crc16 = seed;
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		crc16 ^= (uint16_t)( (uint16_t) p_data[i] << 8U );
+
+		for ( uint8_t bit = 0; bit < 8U; bit++ )
+		{
+			if ( 0U != ( crc16 & 0x8000U ))
+			{
+				crc16 = (uint16_t)(( crc16 << 1U ) ^ PAR_IF_CRC_POLY );
+			}
+			else
+			{
+				crc16 = (uint16_t)( crc16 << 1U );
+			}
+		}
+	}
+
+	return crc16;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get timestamp
+*
+* @return 		ts - Timestamp in ns, wraps around
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t par_if_get_ts(void)
+{
+	return (uint32_t) par_if_get_ns();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
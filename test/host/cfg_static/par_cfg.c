@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_cfg.c
+*@brief     Configuration for device parameters host build with static layout
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host build parameter table generated from "PAR_CFG_TABLE" list.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "par_cfg.h"
+#include "parameters/src/par.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *	Parameters definitions
+ */
+#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+
+	/**
+	 * 	Hot, default value and cold tables are generated from
+	 * 	"PAR_CFG_TABLE" list in par_cfg.h
+	 */
+	static const par_cfg_hot_t g_par_table_hot[ePAR_NUM_OF] =
+	{
+		PAR_CFG_TABLE( PAR_CFG_TABLE_HOT_ENTRY )
+	};
+
+	static const par_type_t g_par_table_def[ePAR_NUM_OF] =
+	{
+		PAR_CFG_TABLE( PAR_CFG_TABLE_DEF_ENTRY )
+	};
+
+	static const par_cfg_cold_t g_par_table_cold[ePAR_NUM_OF] =
+	{
+		PAR_CFG_TABLE( PAR_CFG_TABLE_COLD_ENTRY )
+	};
+
+#else
+
+	/**
+	 * 	Table is generated from "PAR_CFG_TABLE" list in par_cfg.h
+	 */
+	static const par_cfg_t g_par_table[ePAR_NUM_OF] =
+	{
+		PAR_CFG_TABLE( PAR_CFG_TABLE_ENTRY )
+	};
+
+#endif
+
+/**
+ * 	Table size in bytes
+ */
+#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+	static const uint32_t gu32_par_table_size = ( sizeof( g_par_table_hot ) + sizeof( g_par_table_def ) + sizeof( g_par_table_cold ));
+#else
+	static const uint32_t gu32_par_table_size = sizeof( g_par_table );
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get parameter hot configuration table
+	*
+	* @return		pointer to hot configuration table
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	const void * par_cfg_get_table_hot(void)
+	{
+		return (const par_cfg_hot_t*) &g_par_table_hot;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get parameter default values table
+	*
+	* @return		pointer to default values table
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	const void * par_cfg_get_table_def(void)
+	{
+		return (const par_type_t*) &g_par_table_def;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get parameter cold configuration table
+	*
+	* @return		pointer to cold configuration table
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	const void * par_cfg_get_table_cold(void)
+	{
+		return (const par_cfg_cold_t*) &g_par_table_cold;
+	}
+
+#else
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get parameter configuration table
+	*
+	* @return		pointer to configuration table
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	const void * par_cfg_get_table(void)
+	{
+		return (const par_cfg_t*) &g_par_table;
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get configuration table size in bytes
+*
+* @return	gu32_par_table_size	- Size of table in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t par_cfg_get_table_size(void)
+{
+	return gu32_par_table_size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,162 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_cfg.h
+*@brief    	Configuration for device parameters host build with static layout
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Host build configuration with static layout, split table and shared
+* 	memory enabled.
+*
+* @note		Parameter table is fixed by "PAR_CFG_TABLE" list, therefore
+* 			"TABLE_SIZES" of host build does not apply. Remaining options
+* 			are kept in cfg/par_cfg_host.h.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _PAR_CFG_H_
+#define _PAR_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Layout options, enabled by this configuration
+ *
+ * 	@note	Split table and shared memory can be turned off from command
+ * 			line, e.g. "-DPAR_CFG_TABLE_SOA_EN=0". Shared memory is placed
+ * 			by cfg_static/par_shared.c.
+ */
+#define PAR_CFG_STATIC_LAYOUT_EN				( 1 )
+
+#ifndef PAR_CFG_TABLE_SOA_EN
+	#define PAR_CFG_TABLE_SOA_EN					( 1 )
+#endif
+
+#ifndef PAR_CFG_SHARED_EN
+	#define PAR_CFG_SHARED_EN						( 1 )
+#endif
+
+/**
+ * 	Common host build options
+ */
+#include "par_cfg_host.h"
+
+/**
+ * 	List of device parameters
+ *
+ * 	@note	Same typed parameters as cfg/par_cfg.h, followed by one
+ * 			non-persistent array and few persistent U32 fillers, last
+ * 			of them read only.
+ */
+typedef enum
+{
+	ePAR_BENCH_U8 = 0,
+	ePAR_BENCH_I8,
+	ePAR_BENCH_U16,
+	ePAR_BENCH_I16,
+	ePAR_BENCH_U32,
+	ePAR_BENCH_I32,
+	ePAR_BENCH_F32,
+	ePAR_BENCH_Q15,
+	ePAR_BENCH_Q31,
+
+	#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+		ePAR_BENCH_U64,
+		ePAR_BENCH_I64,
+	#endif
+
+	ePAR_BENCH_ARR,
+
+	ePAR_BENCH_FILL,
+	ePAR_BENCH_FILL_1,
+	ePAR_BENCH_FILL_2,
+	ePAR_BENCH_FILL_3,
+
+	ePAR_NUM_OF
+} par_num_t;
+
+/**
+ * 	Number of parameters in table
+ */
+#define PAR_HOST_TABLE_SIZE						( ePAR_NUM_OF )
+
+/**
+ * 	Parameter ID of first filler parameter
+ */
+#define PAR_HOST_FILL_ID_START					( 100U )
+
+/**
+ * 	64-bit parameters of "PAR_CFG_TABLE" list
+ */
+#if ( 1 == PAR_CFG_TYPE_64BIT_EN )
+	#define PAR_HOST_TABLE_64BIT( PAR ) \
+		PAR(	ePAR_BENCH_U64,		11,		"U64",		0,				10000000000,	5000000000,		NULL,	U64,		ePAR_ACCESS_RW,		true,		"U64 parameter"	) \
+		PAR(	ePAR_BENCH_I64,		12,		"I64",		-10000000000,	10000000000,	-5000000000,	NULL,	I64,		ePAR_ACCESS_RW,		true,		"I64 parameter"	)
+#else
+	#define PAR_HOST_TABLE_64BIT( PAR )
+#endif
+
+/**
+ *	Parameters definitions list
+ *
+ *	@note	U8 is critical with "PAR_CFG_NVM_LAZY_EN" and array has four
+ *			elements with "PAR_CFG_ARRAY_EN", so that optional columns
+ *			are built as well.
+ */
+#define PAR_CFG_TABLE( PAR ) \
+\
+	/*		Enumeration			ID		Name		Min				Max				Def			Unit	Data type	PC Access			Persistent	Description				Len		Critical	*/ \
+	PAR(	ePAR_BENCH_U8,		1,		"U8",		0,				200,			10,			NULL,	U8,			ePAR_ACCESS_RW,		true,		"U8 parameter",			1U,		true		) \
+	PAR(	ePAR_BENCH_I8,		2,		"I8",		-100,			100,			-10,		NULL,	I8,			ePAR_ACCESS_RW,		true,		"I8 parameter"							) \
+	PAR(	ePAR_BENCH_U16,		3,		"U16",		0,				60000,			1000,		NULL,	U16,		ePAR_ACCESS_RW,		true,		"U16 parameter"							) \
+	PAR(	ePAR_BENCH_I16,		4,		"I16",		-30000,			30000,			-1000,		NULL,	I16,		ePAR_ACCESS_RW,		true,		"I16 parameter"							) \
+	PAR(	ePAR_BENCH_U32,		5,		"U32",		0,				4000000000,		100000,		NULL,	U32,		ePAR_ACCESS_RW,		true,		"U32 parameter"							) \
+	PAR(	ePAR_BENCH_I32,		6,		"I32",		-2000000000,	2000000000,		-100000,	NULL,	I32,		ePAR_ACCESS_RW,		true,		"I32 parameter"							) \
+	PAR(	ePAR_BENCH_F32,		7,		"F32",		-1000.0f,		1000.0f,		0.5f,		"V",	F32,		ePAR_ACCESS_RW,		true,		"F32 parameter"							) \
+	PAR(	ePAR_BENCH_Q15,		8,		"Q15",		-16384,			16384,			0,			NULL,	Q15,		ePAR_ACCESS_RW,		true,		"Q15 parameter"							) \
+	PAR(	ePAR_BENCH_Q31,		9,		"Q31",		-1073741824,	1073741824,		0,			NULL,	Q31,		ePAR_ACCESS_RW,		true,		"Q31 parameter"							) \
+	PAR_HOST_TABLE_64BIT( PAR ) \
+	PAR(	ePAR_BENCH_ARR,		10,		"Array",	0,				1000,			7,			NULL,	U16,		ePAR_ACCESS_RW,		false,		"Array parameter",		4U						) \
+	PAR(	ePAR_BENCH_FILL,	100,	"Fill",		0,				1000000,		10,			NULL,	U32,		ePAR_ACCESS_RW,		true,		"Filler parameter"						) \
+	PAR(	ePAR_BENCH_FILL_1,	101,	"Fill",		0,				1000000,		11,			NULL,	U32,		ePAR_ACCESS_RW,		true,		"Filler parameter"						) \
+	PAR(	ePAR_BENCH_FILL_2,	102,	"Fill",		0,				1000000,		12,			NULL,	U32,		ePAR_ACCESS_RW,		true,		"Filler parameter"						) \
+	PAR(	ePAR_BENCH_FILL_3,	103,	"Fill",		0,				1000000,		13,			NULL,	U32,		ePAR_ACCESS_RO,		true,		"Filler parameter"						) \
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+#if ( 1 == PAR_CFG_TABLE_SOA_EN )
+	const void * 	par_cfg_get_table_hot	(void);
+	const void * 	par_cfg_get_table_def	(void);
+	const void * 	par_cfg_get_table_cold	(void);
+#else
+	const void * 	par_cfg_get_table		(void);
+#endif
+
+uint32_t	 	par_cfg_get_table_size	(void);
+
+#endif // _PAR_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
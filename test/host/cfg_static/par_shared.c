@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      par_shared.c
+*@brief     Shared memory of device parameters host build
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup PAR_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Stub of "PAR_CFG_SHARED_SYMBOL" shared memory.
+*
+* @note		On target symbol is placed by linker script into RAM shared
+* 			between cores. Its layout is private to par.c, therefore host
+* 			reserves aligned memory of "PAR_HOST_SHARED_SIZE" bytes, big
+* 			enough for cfg_static/par_cfg.h table.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "par_cfg.h"
+
+#if ( 1 == PAR_CFG_SHARED_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of shared memory in bytes
+ */
+#define PAR_HOST_SHARED_SIZE					( 4096U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Parameters shared memory
+ */
+_Alignas( 8 ) uint8_t PAR_CFG_SHARED_SYMBOL[ PAR_HOST_SHARED_SIZE ];
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
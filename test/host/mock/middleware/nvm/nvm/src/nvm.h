@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm.h
+*@brief    	RAM backed NVM mock for host build
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_MOCK
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _NVM_H_
+#define _NVM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Mocked NVM module version
+ */
+#define NVM_VER_MAJOR          ( 2 )
+#define NVM_VER_MINOR          ( 1 )
+#define NVM_VER_DEVELOP        ( 0 )
+
+/**
+ * 	Size of RAM backed NVM region
+ *
+ * 	Unit: byte
+ */
+#ifndef NVM_MOCK_SIZE
+	#define NVM_MOCK_SIZE		( 65536UL )
+#endif
+
+/**
+ * 	NVM status
+ */
+typedef enum
+{
+	eNVM_OK 	= 0x00U,	/**<Normal operation */
+	eNVM_ERROR 	= 0x01U,	/**<General error code */
+} nvm_status_t;
+
+/**
+ * 	NVM regions
+ */
+typedef enum
+{
+	eNVM_REGION_EEPROM_RUN_PAR = 0,	/**<Device parameters region */
+
+	eNVM_REGION_NUM_OF
+} nvm_region_name_t;
+
+/**
+ * 	NVM bus operation counters
+ */
+typedef struct
+{
+	uint32_t	read_cnt;		/**<Number of read operations */
+	uint32_t	read_bytes;		/**<Number of read bytes */
+	uint32_t	write_cnt;		/**<Number of write operations */
+	uint32_t	write_bytes;	/**<Number of written bytes */
+	uint32_t	erase_cnt;		/**<Number of erase operations */
+	uint32_t	erase_bytes;	/**<Number of erased bytes */
+	uint32_t	sync_cnt;		/**<Number of sync operations */
+} nvm_mock_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_init		(void);
+nvm_status_t nvm_deinit		(void);
+nvm_status_t nvm_is_init	(bool * const p_is_init);
+nvm_status_t nvm_read		(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+nvm_status_t nvm_write		(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+nvm_status_t nvm_erase		(const nvm_region_name_t region, const uint32_t addr, const uint32_t size);
+nvm_status_t nvm_sync		(const nvm_region_name_t region);
+
+void		 nvm_mock_get_stats		(nvm_mock_stats_t * const p_stats);
+void		 nvm_mock_clear_stats	(void);
+void		 nvm_mock_erase_all		(void);
+nvm_status_t nvm_mock_load_image	(const char * const p_path);
+nvm_status_t nvm_mock_store_image	(const char * const p_path);
+
+#endif // _NVM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,359 @@
+// Copyright (c) 2025 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      nvm_mock.c
+*@brief     RAM backed NVM mock for host build
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@date      06.12.2024
+*@version   V2.2.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup NVM_MOCK
+* @{ <!-- BEGIN GROUP -->
+*
+* 	RAM backed NVM mock.
+*
+* @brief	Single region of "NVM_MOCK_SIZE" bytes kept in RAM. Each bus
+* 			operation and number of transferred bytes is counted, so that
+* 			NVM traffic of parameters module can be measured on host.
+*
+* 			Erased memory reads as 0xFF, same as flash.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+
+#include "middleware/nvm/nvm/src/nvm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	NVM memory content
+ */
+static uint8_t gu8_nvm_mem[ NVM_MOCK_SIZE ];
+
+/**
+ * 	NVM bus operation counters
+ */
+static nvm_mock_stats_t g_nvm_stats = { 0 };
+
+/**
+ * 	Initialization guard and first initialization flag
+ */
+static bool gb_is_init 		= false;
+static bool gb_is_erased	= false;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if access is inside NVM region
+*
+* @param[in]	region	- NVM region
+* @param[in]	addr	- Start address
+* @param[in]	size	- Size of access in bytes
+* @return		valid	- True if access is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool nvm_mock_is_valid(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+{
+	return (	( true == gb_is_init )
+			&&	( region < eNVM_REGION_NUM_OF )
+			&&	( addr <= NVM_MOCK_SIZE )
+			&&	( size <= ( NVM_MOCK_SIZE - addr )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize NVM
+*
+* @note		Memory is erased at first init only, afterwards content is
+* 			kept between de-init and init, as on real device.
+*
+* @return		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_init(void)
+{
+	if ( false == gb_is_erased )
+	{
+		nvm_mock_erase_all();
+	}
+
+	gb_is_init = true;
+
+	return eNVM_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		De-initialize NVM
+*
+* @return		status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_deinit(void)
+{
+	gb_is_init = false;
+
+	return eNVM_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get NVM initialization flag
+*
+* @param[out]	p_is_init	- Pointer to initialization flag
+* @return		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_is_init(bool * const p_is_init)
+{
+	nvm_status_t status = eNVM_OK;
+
+	if ( NULL != p_is_init )
+	{
+		*p_is_init = gb_is_init;
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read from NVM
+*
+* @param[in]	region	- NVM region
+* @param[in]	addr	- Start address
+* @param[in]	size	- Size of data in bytes
+* @param[out]	p_data	- Read data
+* @return		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_read(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+	nvm_status_t status = eNVM_OK;
+
+	if (( true == nvm_mock_is_valid( region, addr, size )) && ( NULL != p_data ))
+	{
+		memcpy( p_data, &gu8_nvm_mem[addr], size );
+
+		g_nvm_stats.read_cnt++;
+		g_nvm_stats.read_bytes += size;
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write to NVM
+*
+* @param[in]	region	- NVM region
+* @param[in]	addr	- Start address
+* @param[in]	size	- Size of data in bytes
+* @param[in]	p_data	- Data to write
+* @return		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_write(const nvm_region_name_t region, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	nvm_status_t status = eNVM_OK;
+
+	if (( true == nvm_mock_is_valid( region, addr, size )) && ( NULL != p_data ))
+	{
+		memcpy( &gu8_nvm_mem[addr], p_data, size );
+
+		g_nvm_stats.write_cnt++;
+		g_nvm_stats.write_bytes += size;
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase NVM
+*
+* @param[in]	region	- NVM region
+* @param[in]	addr	- Start address
+* @param[in]	size	- Size of erased area in bytes
+* @return		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_erase(const nvm_region_name_t region, const uint32_t addr, const uint32_t size)
+{
+	nvm_status_t status = eNVM_OK;
+
+	if ( true == nvm_mock_is_valid( region, addr, size ))
+	{
+		memset( &gu8_nvm_mem[addr], 0xFF, size );
+
+		g_nvm_stats.erase_cnt++;
+		g_nvm_stats.erase_bytes += size;
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sync NVM
+*
+* @param[in]	region	- NVM region
+* @return		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_sync(const nvm_region_name_t region)
+{
+	nvm_status_t status = eNVM_OK;
+
+	if ( true == nvm_mock_is_valid( region, 0UL, 0UL ))
+	{
+		g_nvm_stats.sync_cnt++;
+	}
+	else
+	{
+		status = eNVM_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get NVM bus operation counters
+*
+* @param[out]	p_stats	- Pointer to counters
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_mock_get_stats(nvm_mock_stats_t * const p_stats)
+{
+	if ( NULL != p_stats )
+	{
+		*p_stats = g_nvm_stats;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clear NVM bus operation counters
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_mock_clear_stats(void)
+{
+	memset( &g_nvm_stats, 0, sizeof( g_nvm_stats ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase complete NVM content
+*
+* @note		Not counted as bus operation.
+*
+* @return		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void nvm_mock_erase_all(void)
+{
+	memset( gu8_nvm_mem, 0xFF, sizeof( gu8_nvm_mem ));
+	gb_is_erased = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load complete NVM content from image file
+*
+* @note		Used to boot on NVM image written by other build, e.g. to
+* 			check migration of NVM layout. Not counted as bus operation.
+*
+* @param[in]	p_path	- Path to image file
+* @return		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_mock_load_image(const char * const p_path)
+{
+	nvm_status_t 	status 	= eNVM_ERROR;
+	FILE *			p_file	= fopen( p_path, "rb" );
+
+	if ( NULL != p_file )
+	{
+		if ( sizeof( gu8_nvm_mem ) == fread( gu8_nvm_mem, 1U, sizeof( gu8_nvm_mem ), p_file ))
+		{
+			gb_is_erased = true;
+			status = eNVM_OK;
+		}
+
+		(void) fclose( p_file );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Store complete NVM content to image file
+*
+* @note		Not counted as bus operation.
+*
+* @param[in]	p_path	- Path to image file
+* @return		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+nvm_status_t nvm_mock_store_image(const char * const p_path)
+{
+	nvm_status_t 	status 	= eNVM_ERROR;
+	FILE *			p_file	= fopen( p_path, "wb" );
+
+	if ( NULL != p_file )
+	{
+		if ( sizeof( gu8_nvm_mem ) == fwrite( gu8_nvm_mem, 1U, sizeof( gu8_nvm_mem ), p_file ))
+		{
+			status = eNVM_OK;
+		}
+
+		if ( 0 != fclose( p_file ))
+		{
+			status = eNVM_ERROR;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////